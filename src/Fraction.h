@@ -1,8 +1,15 @@
+#pragma once
+
 #include <type_traits>
 #include <compare>
 #include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <concepts>
+#include <bit>
+#include <cstdint>
+
+#include "FractionGCD.h"
 
 // Concepts for convertible_to. -> My stdlib doesn't have this at the moment. :(
 template <class From, class To>
@@ -25,6 +32,59 @@ concept MathType = std::is_arithmetic_v<T> || CustomType<T>;
 template <MathType Type>
 class Fraction;
 
+/**
+ * @brief Rounding modes for converting a Fraction to fewer digits or to an integer.
+ *
+ * HalfUp and HalfDown resolve ties away from and towards zero, all other values round to nearest.
+ */
+enum class RoundingMode
+{
+    Floor,
+    Ceiling,
+    TowardZero,
+    AwayFromZero,
+    HalfUp,
+    HalfDown,
+    HalfEven
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Decides whether a truncated magnitude has to be incremented by one unit.
+     * @param xNegative The value is negative.
+     * @param xOdd The truncated magnitude is odd, only used for HalfEven.
+     * @param xRemainder The discarded part is xRemainder / xDivisor with 0 <= xRemainder < xDivisor.
+     */
+    template <typename Unsigned_t>
+    [[nodiscard]] constexpr bool round_away(RoundingMode xMode, bool xNegative, bool xOdd, const Unsigned_t &xRemainder,
+                                            const Unsigned_t &xDivisor) noexcept
+    {
+        if (xRemainder == Unsigned_t(0))
+            return false;
+        // Compare 2 r with d without overflowing.
+        const Unsigned_t tRest = xDivisor - xRemainder;
+        switch (xMode)
+        {
+        case RoundingMode::Floor:
+            return xNegative;
+        case RoundingMode::Ceiling:
+            return !xNegative;
+        case RoundingMode::TowardZero:
+            return false;
+        case RoundingMode::AwayFromZero:
+            return true;
+        case RoundingMode::HalfUp:
+            return !(xRemainder < tRest);
+        case RoundingMode::HalfDown:
+            return tRest < xRemainder;
+        case RoundingMode::HalfEven:
+            return tRest < xRemainder || (xRemainder == tRest && xOdd);
+        }
+        return false;
+    }
+}
+
 /**
  * @brief Converts a floating-point value to a Fraction with integral numerator and denominator.
  * @tparam Arg_t The type of the input value.
@@ -74,6 +134,180 @@ template <typename Arg_t, MathType Integral_t = int>
     return Fraction<Integral_t>{0, 0};
 }
 
+#ifdef __SIZEOF_INT128__
+namespace fraction_detail
+{
+    /**
+     * @brief Three-way comparison of a / b and c / d through their continued fractions, so nothing is multiplied.
+     */
+    [[nodiscard]] constexpr int compare_quotients(unsigned __int128 a, unsigned __int128 b, unsigned __int128 c, unsigned __int128 d) noexcept
+    {
+        while (true)
+        {
+            const unsigned __int128 tLhs = a / b;
+            const unsigned __int128 tRhs = c / d;
+            if (tLhs != tRhs)
+                return tLhs < tRhs ? -1 : 1;
+            const unsigned __int128 tLhsRest = a % b;
+            const unsigned __int128 tRhsRest = c % d;
+            if (tLhsRest == 0 || tRhsRest == 0)
+                return static_cast<int>(tLhsRest != 0) - static_cast<int>(tRhsRest != 0);
+            // ra / b < rc / d <=> d / rc < b / ra
+            a = d;
+            d = tLhsRest;
+            c = b;
+            b = tRhsRest;
+        }
+    }
+}
+#endif
+
+namespace fraction_detail
+{
+    /**
+     * @brief Best approximation n / d of the finite xValue with 0 < d <= xMaxDenominator, see to_Fraction_bounded().
+     * @return false if the numerator does not fit into Integral_t.
+     */
+    template <typename Arg_t, typename Integral_t>
+    [[nodiscard]] bool bounded_fraction(Arg_t xValue, Integral_t xMaxDenominator, Integral_t &n, Integral_t &d) noexcept
+    {
+        const auto tStore = [xValue, &n, &d](auto p, auto q)
+        {
+            if (p > static_cast<decltype(p)>(std::numeric_limits<Integral_t>::max()))
+                return false;
+            const auto tNumerator = static_cast<Integral_t>(p);
+            if constexpr (std::is_signed_v<Integral_t>)
+            {
+                n = xValue < 0 ? static_cast<Integral_t>(-tNumerator) : tNumerator;
+            }
+            else
+            {
+                if (xValue < 0 && tNumerator != Integral_t(0))
+                    return false;
+                n = tNumerator;
+            }
+            d = static_cast<Integral_t>(q);
+            return true;
+        };
+
+#ifdef __SIZEOF_INT128__
+        if constexpr (std::numeric_limits<Arg_t>::digits <= 53)
+        {
+            using Wide_t = unsigned __int128;
+
+            // |xValue| = tMantissa / 2^tShift exactly, tMantissa odd.
+            int tExponent = 0;
+            const Arg_t tFraction = std::frexp(std::abs(xValue), &tExponent);
+            if (tFraction == 0)
+                return tStore(Wide_t(0), Wide_t(1));
+            auto tMantissa = static_cast<std::uint64_t>(std::ldexp(tFraction, 53));
+            int tShift = 53 - tExponent;
+            const int tZeros = std::countr_zero(tMantissa);
+            tMantissa >>= tZeros;
+            tShift -= tZeros;
+
+            const int tWidth = std::bit_width(tMantissa);
+            if (tShift <= 0)
+            {
+                if (tWidth - tShift > std::numeric_limits<std::uint64_t>::digits)
+                    return false;
+                return tStore(Wide_t(tMantissa) << -tShift, Wide_t(1));
+            }
+            // Below 2^-66 even 1 / 2^64 is farther away than 0.
+            if (tWidth - tShift <= -66)
+                return tStore(Wide_t(0), Wide_t(1));
+
+            const auto tMax = static_cast<Wide_t>(xMaxDenominator);
+            Wide_t a = tMantissa;
+            Wide_t b = Wide_t(1) << tShift;
+            Wide_t p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+            while (b != 0)
+            {
+                const Wide_t t = a / b;
+                if (q1 != 0 && t > (tMax - q0) / q1)
+                    break;
+                const Wide_t p2 = p0 + t * p1;
+                const Wide_t q2 = q0 + t * q1;
+                p0 = p1;
+                q0 = q1;
+                p1 = p2;
+                q1 = q2;
+                const Wide_t r = a - t * b;
+                a = b;
+                b = r;
+            }
+            if (b == 0)
+                return tStore(p1, q1);
+
+            // The complete quotient y = a / b failed the bound. The semiconvergent with k = (max - q0) / q1
+            // is closer than p1 / q1 iff y < 2k + q0 / q1, and q0 <= q1.
+            const Wide_t k = (tMax - q0) / q1;
+            const Wide_t t = a / b;
+            const bool tSemi = t < 2 * k || (t == 2 * k && compare_quotients(a - t * b, b, q0, q1) < 0);
+            return tSemi ? tStore(p0 + k * p1, q0 + k * q1) : tStore(p1, q1);
+        }
+        else
+#endif
+        {
+            const long double tTarget = std::abs(static_cast<long double>(xValue));
+            const auto tMax = static_cast<long double>(xMaxDenominator);
+            long double p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+            long double x = tTarget;
+            for (int i = 0; i < 64; ++i)
+            {
+                const long double a = std::floor(x);
+                const long double q2 = q0 + a * q1;
+                if (q2 > tMax)
+                    break;
+                const long double p2 = p0 + a * p1;
+                p0 = p1;
+                q0 = q1;
+                p1 = p2;
+                q1 = q2;
+                if (x == a)
+                    break;
+                x = 1 / (x - a);
+            }
+
+            // Largest semiconvergent below the bound.
+            const long double k = std::floor((tMax - q0) / q1);
+            const long double tSemiP = p0 + k * p1;
+            const long double tSemiQ = q0 + k * q1;
+            if (std::abs(tSemiP / tSemiQ - tTarget) < std::abs(p1 / q1 - tTarget))
+                return tStore(tSemiP, tSemiQ);
+            return tStore(p1, q1);
+        }
+    }
+}
+
+/**
+ * @brief Returns the fraction closest to xValue among all fractions with a denominator of at most xMaxDenominator.
+ *
+ * Walks the continued fraction of xValue until the next convergent's denominator would exceed
+ * xMaxDenominator, then picks the closer of the last convergent and the largest admissible
+ * semiconvergent. Unlike to_Fraction() the size of the result is bounded, e.g. pi with 1000 gives 355/113.
+ * For float and double the expansion runs on the exact binary value in 128-bit integers, so the
+ * result is the true best approximation; a value whose binary fraction fits is returned exactly.
+ *
+ * @exception std::invalid_argument - If xValue is not finite or xMaxDenominator is less than 1.
+ * @exception std::overflow_error - If the numerator does not fit into Integral_t.
+ */
+template <typename Arg_t, MathType Integral_t>
+[[nodiscard]] Fraction<Integral_t> to_Fraction_bounded(Arg_t xValue, Integral_t xMaxDenominator) noexcept(false)
+    requires std::is_floating_point_v<Arg_t> && std::is_integral_v<Integral_t> && (sizeof(Integral_t) <= sizeof(std::uint64_t))
+{
+    if (!std::isfinite(xValue))
+        throw std::invalid_argument("Value must be finite.");
+    if (xMaxDenominator < Integral_t(1))
+        throw std::invalid_argument("Maximal denominator must be at least 1.");
+
+    Integral_t tNumerator{0};
+    Integral_t tDenominator{1};
+    if (!fraction_detail::bounded_fraction(xValue, xMaxDenominator, tNumerator, tDenominator))
+        throw std::overflow_error("Numerator does not fit into the fraction's value type.");
+    return Fraction<Integral_t>{tNumerator, tDenominator};
+}
+
 /**
  * @brief Represents a fraction with integral numerator and denominator.
  */
@@ -85,23 +319,17 @@ class Fraction
 
     /**
      * @brief Calculates the greatest common divisor (GCD) of two numbers.
+     *
+     * Dispatches to fraction_GCD(), which picks binary, Lehmer or Euclidean GCD depending on Type.
+     * The result is non-negative, the GCD of 0 and x is |x|.
+     *
      * @param a The first number.
      * @param b The second number.
      * @return The GCD of a and b.
      */
-    constexpr Type GDC(const Type &a, const Type &b) noexcept
+    static constexpr Type GDC(const Type &a, const Type &b) noexcept
     {
-        auto tResult = std::min(a, b);
-        while (tResult > 0)
-        {
-            if (a % tResult == 0 && b % tResult == 0)
-            {
-                break;
-            }
-            --tResult;
-        }
-
-        return tResult;
+        return fraction_GCD(a, b);
     }
 
     /**
@@ -110,13 +338,22 @@ class Fraction
      * @param b The second number.
      * @return The LCM of a and b.
      */
-    constexpr Type LCM(const Type &a, const Type &b) noexcept
+    static constexpr Type LCM(const Type &a, const Type &b) noexcept
     {
         if (a == 0 || b == 0)
         {
             return 0;
         }
-        return std::abs(a * b) / GDC(a, b);
+        return std::abs(a / GDC(a, b) * b);
+    }
+
+    struct RawTag
+    {
+    };
+
+    constexpr Fraction(RawTag, const Type &xNumerator, const Type &xDenominator) noexcept(std::is_nothrow_copy_constructible_v<Type>)
+        : mNumerator{xNumerator}, mDenominator{xDenominator}
+    {
     }
 
 public:
@@ -165,6 +402,20 @@ public:
             throw std::invalid_argument("Denominator must be unequal zero!");
     }
 
+    /**
+     * @brief Constructs a Fraction without checking the denominator, for trusted data in hot paths.
+     *
+     * Unlike the constructors this never throws, so it does not prevent inlining. A zero
+     * denominator is not detected; use make_Fraction() from FractionExpected.h for untrusted input.
+     *
+     * @param xNumerator - The numerator value for the fraction.
+     * @param xDenominator - The denominator value, must be unequal zero.
+     */
+    [[nodiscard]] static constexpr Fraction from_raw(const Type &xNumerator, const Type &xDenominator) noexcept(std::is_nothrow_copy_constructible_v<Type>)
+    {
+        return Fraction{RawTag{}, xNumerator, xDenominator};
+    }
+
     /**
      * @brief Copy constructor.
      * Constructs a Fraction from another Fraction, copying its numerator and denominator.
@@ -349,6 +600,8 @@ public:
 
     /**
      * @brief Simplifies the fraction by dividing both the numerator and denominator by their greatest common divisor.
+     *
+     * For signed types the sign is moved to the numerator, so the denominator of the result is positive.
      * @return Returns a reference to the simplified fraction.
      **/
     constexpr Fraction &simplify() noexcept
@@ -357,6 +610,15 @@ public:
         mNumerator /= tGDC;
         mDenominator /= tGDC;
 
+        if constexpr (!std::is_unsigned_v<Type>)
+        {
+            if (mDenominator < Type(0))
+            {
+                mNumerator = -mNumerator;
+                mDenominator = -mDenominator;
+            }
+        }
+
         return *this;
     }
 
@@ -577,6 +839,133 @@ public:
     }
 };
 
+namespace fraction_detail
+{
+    /**
+     * @brief Returns |xValue| as the unsigned counterpart for built-in types, also for the minimal value.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr auto round_magnitude(const Type &xValue) noexcept
+    {
+        if constexpr (std::is_integral_v<Type>)
+        {
+            using Unsigned_t = std::make_unsigned_t<Type>;
+            return xValue < Type(0) ? static_cast<Unsigned_t>(Unsigned_t(0) - static_cast<Unsigned_t>(xValue)) : static_cast<Unsigned_t>(xValue);
+        }
+        else
+        {
+            return gcd_abs(xValue);
+        }
+    }
+
+    /**
+     * @brief Rounds xNumerator / xDenominator to an integer with one truncating division.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr Type round_quotient(const Type &xNumerator, const Type &xDenominator, RoundingMode xMode) noexcept
+    {
+        // Quotient and remainder of the same operands compile to a single division.
+        Type tQuotient = xNumerator / xDenominator;
+        const Type tRemainder = xNumerator % xDenominator;
+        if (tRemainder == Type(0))
+            return tQuotient;
+
+        bool tNegative = false;
+        if constexpr (!std::is_unsigned_v<Type>)
+            tNegative = (xNumerator < Type(0)) != (xDenominator < Type(0));
+        const bool tOdd = tQuotient % Type(2) != Type(0);
+        if (round_away(xMode, tNegative, tOdd, round_magnitude(tRemainder), round_magnitude(xDenominator)))
+            tQuotient = tNegative ? tQuotient - Type(1) : tQuotient + Type(1);
+        return tQuotient;
+    }
+}
+
+// Concepts for types with an integer remainder.
+template <typename T>
+concept IntegralMathType = MathType<T> && requires(T a, T b) {
+    { a % b } -> ::convertible_to<T>;
+};
+
+/**
+ * @brief Integer part and proper fraction of a value, see mixed_parts().
+ */
+template <MathType Type>
+struct MixedParts
+{
+    Type whole;
+    Fraction<Type> fraction;
+};
+
+/**
+ * @brief Quotient and remainder of a fraction division, see divmod().
+ */
+template <MathType Type>
+struct FractionDivMod
+{
+    Type quotient;
+    Fraction<Type> remainder;
+};
+
+/**
+ * @brief Rounds a fraction to an integer, exactly and with a single integer division.
+ * @param xMode The rounding mode, ties away from zero by default like std::round.
+ */
+template <IntegralMathType Type>
+[[nodiscard]] constexpr Type round(const Fraction<Type> &_in, RoundingMode xMode = RoundingMode::HalfUp) noexcept
+{
+    return fraction_detail::round_quotient(_in.getNumerator(), _in.getDenominator(), xMode);
+}
+template <IntegralMathType Type>
+[[nodiscard]] constexpr Type floor(const Fraction<Type> &_in) noexcept
+{
+    return fraction_detail::round_quotient(_in.getNumerator(), _in.getDenominator(), RoundingMode::Floor);
+}
+template <IntegralMathType Type>
+[[nodiscard]] constexpr Type ceil(const Fraction<Type> &_in) noexcept
+{
+    return fraction_detail::round_quotient(_in.getNumerator(), _in.getDenominator(), RoundingMode::Ceiling);
+}
+template <IntegralMathType Type>
+[[nodiscard]] constexpr Type trunc(const Fraction<Type> &_in) noexcept
+{
+    return _in.getNumerator() / _in.getDenominator();
+}
+
+/**
+ * @brief Splits a fraction into integer part and proper fraction like std::modf: -7/2 = -3 + -1/2.
+ */
+template <IntegralMathType Type>
+[[nodiscard]] constexpr MixedParts<Type> mixed_parts(const Fraction<Type> &_in) noexcept(false)
+{
+    return {_in.getNumerator() / _in.getDenominator(), Fraction<Type>{_in.getNumerator() % _in.getDenominator(), _in.getDenominator()}};
+}
+
+/**
+ * @brief Calculates q = floor(lhs / rhs) and lhs - q rhs, the remainder has the sign of rhs.
+ * @exception std::invalid_argument - If rhs is 0.
+ */
+template <IntegralMathType Type>
+[[nodiscard]] constexpr FractionDivMod<Type> divmod(const Fraction<Type> &lhs, const Fraction<Type> &rhs) noexcept(false)
+{
+    if (rhs.getNumerator() == Type(0))
+        throw std::invalid_argument("Division by zero!");
+
+    // lhs / rhs = n / d, the remainder lhs - q rhs equals (n mod d) / (lhs.den * rhs.den).
+    const Type n = lhs.getNumerator() * rhs.getDenominator();
+    const Type d = lhs.getDenominator() * rhs.getNumerator();
+    Type q = n / d;
+    Type r = n % d;
+    if constexpr (!std::is_unsigned_v<Type>)
+    {
+        if (r != Type(0) && (r < Type(0)) != (d < Type(0)))
+        {
+            q = q - Type(1);
+            r = r + d;
+        }
+    }
+    return {q, Fraction<Type>{r, lhs.getDenominator() * rhs.getDenominator()}.simplify()};
+}
+
 template <typename Type>
 [[nodiscard]] constexpr Fraction<Type> sin(const Fraction<Type> &_in) noexcept(false)
 {
@@ -0,0 +1,330 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionAlgorithm.h"
+#include "FractionChecked.h"
+#include "FractionColumn.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Exact running sum of fractions as one wide integer numerator over a running common denominator.
+ *
+ * Adding a value whose denominator already divides the running denominator is a single multiply-add;
+ * only a new denominator triggers an LCM step. Numerator and denominator are kept in WideProduct_t,
+ * so sums of many Type values do not overflow before the final result is narrowed. Every wide
+ * operation is overflow-checked; if one overflows, the sum is reduced and the step retried once.
+ */
+template <MathType Type>
+class ExactSum
+{
+    using Wide_t = WideProduct_t<Type>;
+
+    Wide_t mNumerator{0};   ///< Sum numerator over mDenominator.
+    Wide_t mDenominator{1}; ///< Positive common denominator of all added values.
+    std::size_t mCount{0};  ///< Number of added values.
+
+    [[nodiscard]] static Type narrow(const Wide_t &xValue) noexcept(false)
+    {
+        if constexpr (!std::is_same_v<Type, Wide_t>)
+        {
+            if (xValue > static_cast<Wide_t>(std::numeric_limits<Type>::max()) || xValue < static_cast<Wide_t>(std::numeric_limits<Type>::lowest()))
+                throw std::overflow_error("Result does not fit into the fraction's value type.");
+        }
+        return static_cast<Type>(xValue);
+    }
+
+    /**
+     * @brief Returns the simplified fraction xNumerator / xDenominator narrowed to Type.
+     */
+    [[nodiscard]] static Fraction<Type> canonical(Wide_t xNumerator, Wide_t xDenominator) noexcept(false)
+    {
+        const Wide_t tGCD = fraction_GCD(xNumerator, xDenominator);
+        if (tGCD > Wide_t(1))
+        {
+            xNumerator = xNumerator / tGCD;
+            xDenominator = xDenominator / tGCD;
+        }
+        return Fraction<Type>{narrow(xNumerator), narrow(xDenominator)};
+    }
+
+    static void reduce(Wide_t &xNumerator, Wide_t &xDenominator) noexcept
+    {
+        const Wide_t tGCD = fraction_GCD(xNumerator, xDenominator);
+        if (tGCD > Wide_t(1))
+        {
+            xNumerator = xNumerator / tGCD;
+            xDenominator = xDenominator / tGCD;
+        }
+    }
+
+    /**
+     * @brief Adds xNumerator / xDenominator; returns false and leaves the sum unchanged if an intermediate overflows.
+     */
+    [[nodiscard]] bool tryAddScaled(const Wide_t &xNumerator, const Wide_t &xDenominator) noexcept
+    {
+        using fraction_detail::add_overflows;
+        using fraction_detail::mul_overflows;
+
+        Wide_t tScaled{};
+        Wide_t tNumerator{};
+        if (mDenominator % xDenominator == Wide_t(0))
+        {
+            if (mul_overflows(xNumerator, mDenominator / xDenominator, tScaled) || add_overflows(mNumerator, tScaled, false, tNumerator))
+                return false;
+            mNumerator = tNumerator;
+            return true;
+        }
+
+        // Knuth: divide out the common factor of the denominators first, only its factors can cancel against the new numerator.
+        const Wide_t tGCD = fraction_GCD(mDenominator, xDenominator);
+        Wide_t tLhs{};
+        Wide_t tDenominator{};
+        if (mul_overflows(mNumerator, xDenominator / tGCD, tLhs) || mul_overflows(xNumerator, mDenominator / tGCD, tScaled) ||
+            add_overflows(tLhs, tScaled, false, tNumerator))
+            return false;
+        const Wide_t tGCD2 = fraction_GCD(tNumerator, tGCD);
+        if (mul_overflows(mDenominator / tGCD, xDenominator / tGCD2, tDenominator))
+            return false;
+        mNumerator = tNumerator / tGCD2;
+        mDenominator = tDenominator;
+        return true;
+    }
+
+    void addScaled(const Wide_t &xNumerator, const Wide_t &xDenominator) noexcept(false)
+    {
+        if (tryAddScaled(xNumerator, xDenominator))
+            return;
+
+        // The fast path does not reduce; factors cancelled so far may bring the sum back into range.
+        reduce(mNumerator, mDenominator);
+        Wide_t tNumerator = xNumerator;
+        Wide_t tDenominator = xDenominator;
+        reduce(tNumerator, tDenominator);
+        if (!tryAddScaled(tNumerator, tDenominator))
+            throw std::overflow_error("Intermediate sum does not fit into the wide accumulator.");
+    }
+
+public:
+    /**
+     * @brief Adds one value.
+     * @exception std::overflow_error - If the reduced running sum does not fit into WideProduct_t.
+     */
+    void add(const Fraction<Type> &xValue) noexcept(false)
+    {
+        Wide_t tNumerator = static_cast<Wide_t>(xValue.getNumerator());
+        Wide_t tDenominator = static_cast<Wide_t>(xValue.getDenominator());
+        if constexpr (!std::is_unsigned_v<Type>)
+        {
+            if (tDenominator < Wide_t(0))
+            {
+                tNumerator = -tNumerator;
+                tDenominator = -tDenominator;
+            }
+        }
+        addScaled(tNumerator, tDenominator);
+        ++mCount;
+    }
+
+    /**
+     * @brief Adds the partial sum of another accumulator, e.g. from another thread.
+     * @exception std::overflow_error - If the reduced running sum does not fit into WideProduct_t.
+     */
+    void merge(const ExactSum &xOther) noexcept(false)
+    {
+        addScaled(xOther.mNumerator, xOther.mDenominator);
+        mCount += xOther.mCount;
+    }
+
+    [[nodiscard]] std::size_t count() const noexcept
+    {
+        return mCount;
+    }
+
+    /**
+     * @brief Returns the sum as simplified fraction.
+     * @exception std::overflow_error - If the simplified sum does not fit into Type.
+     */
+    [[nodiscard]] Fraction<Type> sum() const noexcept(false)
+    {
+        return canonical(mNumerator, mDenominator);
+    }
+
+    /**
+     * @brief Returns the arithmetic mean as simplified fraction.
+     * @exception std::invalid_argument - If no value was added.
+     * @exception std::overflow_error - If the simplified mean does not fit into Type.
+     */
+    [[nodiscard]] Fraction<Type> mean() const noexcept(false)
+    {
+        if (mCount == 0)
+            throw std::invalid_argument("Mean of an empty group.");
+        // Cancel the count against the numerator first, the remaining product is the reduced denominator.
+        const Wide_t tGCD = fraction_GCD(mNumerator, static_cast<Wide_t>(mCount));
+        return canonical(mNumerator / tGCD, fraction_detail::checked_mul(mDenominator, static_cast<Wide_t>(mCount) / tGCD));
+    }
+};
+
+/**
+ * @brief One output row of a group-by aggregation.
+ */
+template <typename Key, MathType Type>
+struct GroupAggregate
+{
+    Key key;
+    Fraction<Type> sum;
+    Fraction<Type> mean;
+    std::size_t count;
+};
+
+/**
+ * @brief Hash aggregation of fraction values by key with exact sums and means.
+ *
+ * Groups are radix-partitioned by key hash. Independent aggregators (one per thread) can be merged
+ * partition by partition, so the merge of partition p only touches partition p of every aggregator
+ * and runs in parallel with the other partitions.
+ */
+template <typename Key, MathType Type, typename Hash = std::hash<Key>>
+class HashAggregator
+{
+    using Map_t = std::unordered_map<Key, ExactSum<Type>, Hash>;
+
+    std::vector<Map_t> mPartitions; ///< Groups by hash partition.
+
+    [[nodiscard]] std::size_t partitionOf(const Key &xKey) const
+    {
+        // Use the upper hash bits for the partition, the maps use the lower ones.
+        const auto tHash = static_cast<std::uint64_t>(Hash{}(xKey)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(tHash >> 32) % mPartitions.size();
+    }
+
+public:
+    /**
+     * @brief Constructs an aggregator with xPartitions hash partitions.
+     */
+    explicit HashAggregator(std::size_t xPartitions = 16)
+        : mPartitions(std::max<std::size_t>(1, xPartitions))
+    {
+    }
+
+    [[nodiscard]] std::size_t partitions() const noexcept
+    {
+        return mPartitions.size();
+    }
+
+    /**
+     * @brief Adds xValue to the group of xKey.
+     */
+    void add(const Key &xKey, const Fraction<Type> &xValue)
+    {
+        mPartitions[partitionOf(xKey)][xKey].add(xValue);
+    }
+
+    /**
+     * @brief Merges partition xPartition of xOther into this aggregator.
+     * @pre Both aggregators have the same number of partitions.
+     */
+    void mergePartition(const HashAggregator &xOther, std::size_t xPartition)
+    {
+        auto &tTarget = mPartitions[xPartition];
+        for (const auto &[tKey, tSum] : xOther.mPartitions[xPartition])
+            tTarget[tKey].merge(tSum);
+    }
+
+    /**
+     * @brief Merges all groups of xOther into this aggregator.
+     * @exception std::invalid_argument - If the partition counts differ.
+     */
+    void merge(const HashAggregator &xOther) noexcept(false)
+    {
+        if (xOther.mPartitions.size() != mPartitions.size())
+            throw std::invalid_argument("Aggregators must have the same number of partitions.");
+        for (std::size_t p = 0; p < mPartitions.size(); ++p)
+            mergePartition(xOther, p);
+    }
+
+    /**
+     * @brief Returns the accumulator of xKey or nullptr if the group does not exist.
+     */
+    [[nodiscard]] const ExactSum<Type> *find(const Key &xKey) const
+    {
+        const auto &tPartition = mPartitions[partitionOf(xKey)];
+        const auto tIt = tPartition.find(xKey);
+        return tIt == tPartition.end() ? nullptr : &tIt->second;
+    }
+
+    /**
+     * @brief Emits one canonical row per group, in unspecified order.
+     * @exception std::overflow_error - If a sum or mean does not fit into Type.
+     */
+    [[nodiscard]] std::vector<GroupAggregate<Key, Type>> finish() const noexcept(false)
+    {
+        std::vector<GroupAggregate<Key, Type>> tResult;
+        for (const auto &tPartition : mPartitions)
+        {
+            for (const auto &[tKey, tSum] : tPartition)
+                tResult.push_back({tKey, tSum.sum(), tSum.mean(), tSum.count()});
+        }
+        return tResult;
+    }
+};
+
+/**
+ * @brief Groups xValues by xKeys and aggregates them in parallel.
+ *
+ * Every thread aggregates a contiguous chunk of rows into its own partitioned HashAggregator.
+ * Afterwards partition p of all thread-local aggregators is merged by one thread per partition.
+ *
+ * @param xKeys The group key per row.
+ * @param xValues The value per row.
+ * @param xOptions Thread count and sequential cut-off.
+ * @return The merged aggregator.
+ * @exception std::invalid_argument - If keys and values have different sizes.
+ */
+template <typename Key, MathType Type, typename Hash = std::hash<Key>>
+[[nodiscard]] HashAggregator<Key, Type, Hash> aggregate_parallel(std::span<const Key> xKeys, const FractionColumn<Type> &xValues,
+                                                                  const FractionParallelOptions &xOptions = {}) noexcept(false)
+{
+    if (xKeys.size() != xValues.size())
+        throw std::invalid_argument("Keys and values must have the same size.");
+
+    const std::size_t tBlocks = fraction_detail::block_count(xKeys.size(), xOptions);
+    const std::size_t tPartitions = std::max<std::size_t>(16, 2 * tBlocks);
+    const std::size_t tBlockSize = (xKeys.size() + tBlocks - 1) / tBlocks;
+    const auto tNumerators = xValues.getNumerators();
+    const auto tDenominators = xValues.getDenominators();
+
+    std::vector<HashAggregator<Key, Type, Hash>> tLocal(tBlocks, HashAggregator<Key, Type, Hash>{tPartitions});
+    fraction_detail::for_each_block(tBlocks,
+                                    [&](std::size_t b)
+                                    {
+                                        const std::size_t tEnd = std::min(xKeys.size(), (b + 1) * tBlockSize);
+                                        for (std::size_t i = b * tBlockSize; i < tEnd; ++i)
+                                            tLocal[b].add(xKeys[i], Fraction<Type>{tNumerators[i], tDenominators[i]});
+                                    });
+
+    if (tBlocks > 1)
+    {
+        const std::size_t tMergeBlocks = std::min(tBlocks, tPartitions);
+        fraction_detail::for_each_block(tMergeBlocks,
+                                        [&](std::size_t b)
+                                        {
+                                            for (std::size_t p = b; p < tPartitions; p += tMergeBlocks)
+                                            {
+                                                for (std::size_t t = 1; t < tBlocks; ++t)
+                                                    tLocal[0].mergePartition(tLocal[t], p);
+                                            }
+                                        });
+    }
+    return std::move(tLocal[0]);
+}
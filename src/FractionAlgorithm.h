@@ -0,0 +1,234 @@
+#pragma once
+
+#include "Fraction.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Options for the parallel fraction algorithms.
+ */
+struct FractionParallelOptions
+{
+    /// Number of worker threads, 0 selects std::thread::hardware_concurrency().
+    std::size_t threads = 0;
+    /// Inputs shorter than this run sequentially, threads would cost more than they save.
+    std::size_t sequentialCutoff = 4096;
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Returns the number of blocks to split xSize elements into.
+     */
+    [[nodiscard]] inline std::size_t block_count(std::size_t xSize, const FractionParallelOptions &xOptions) noexcept
+    {
+        if (xSize < xOptions.sequentialCutoff)
+            return 1;
+        const std::size_t tThreads = xOptions.threads == 0 ? std::thread::hardware_concurrency() : xOptions.threads;
+        return std::max<std::size_t>(1, std::min(tThreads, xSize));
+    }
+
+    /**
+     * @brief Runs xTask(block) for every block, block 0 on the calling thread.
+     */
+    template <typename Task>
+    void for_each_block(std::size_t xBlocks, Task &&xTask)
+    {
+        std::vector<std::future<void>> tFutures;
+        tFutures.reserve(xBlocks);
+        for (std::size_t b = 1; b < xBlocks; ++b)
+            tFutures.push_back(std::async(std::launch::async, [&xTask, b]() { xTask(b); }));
+        xTask(0);
+        for (auto &tFuture : tFutures)
+            tFuture.get();
+    }
+
+    /**
+     * @brief Returns the positive least common multiple of all denominators in xValues.
+     */
+    template <MathType Type>
+    [[nodiscard]] Type common_denominator(std::span<const Fraction<Type>> xValues)
+    {
+        Type tCommon{1};
+        for (const auto &tValue : xValues)
+        {
+            const Type tDenominator = gcd_abs(tValue.getDenominator());
+            tCommon = tCommon / fraction_GCD(tCommon, tDenominator) * tDenominator;
+        }
+        return tCommon;
+    }
+
+    /**
+     * @brief Scans xIn into xOut starting at xOffset; every prefix is accumulated as integer numerator over one common denominator.
+     * @param xInclusive Writes the prefix including (true) or excluding (false) the current element.
+     * @return The sum xOffset + sum(xIn), simplified.
+     */
+    template <MathType Type>
+    Fraction<Type> scan_block(std::span<const Fraction<Type>> xIn, std::span<Fraction<Type>> xOut, const Fraction<Type> &xOffset, bool xInclusive)
+    {
+        const Type tBlockDenominator = common_denominator(xIn);
+        const Type tOffsetDenominator = gcd_abs(xOffset.getDenominator());
+        const Type tDenominator = tBlockDenominator / fraction_GCD(tBlockDenominator, tOffsetDenominator) * tOffsetDenominator;
+
+        Type tNumerator = xOffset.getNumerator() * (tDenominator / xOffset.getDenominator());
+        for (std::size_t i = 0; i < xIn.size(); ++i)
+        {
+            // Read before writing, xOut may alias xIn.
+            const Type tTerm = xIn[i].getNumerator() * (tDenominator / xIn[i].getDenominator());
+            if (!xInclusive && !xOut.empty())
+                xOut[i] = Fraction<Type>{tNumerator, tDenominator}.simplify();
+            tNumerator += tTerm;
+            if (xInclusive && !xOut.empty())
+                xOut[i] = Fraction<Type>{tNumerator, tDenominator}.simplify();
+        }
+        return Fraction<Type>{tNumerator, tDenominator}.simplify();
+    }
+
+    /**
+     * @brief Adds two fractions with Knuth's reduced addition: the result is canonical if both inputs are.
+     */
+    template <MathType Type>
+    [[nodiscard]] Fraction<Type> add_reduced(const Fraction<Type> &a, const Fraction<Type> &b)
+    {
+        const Type tGCD = fraction_GCD(a.getDenominator(), b.getDenominator());
+        const Type tNumerator = a.getNumerator() * (b.getDenominator() / tGCD) + b.getNumerator() * (a.getDenominator() / tGCD);
+        if (tNumerator == Type(0))
+            return Fraction<Type>{Type(0), Type(1)};
+        const Type tGCD2 = fraction_GCD(tNumerator, tGCD);
+        return Fraction<Type>{tNumerator / tGCD2, (a.getDenominator() / tGCD) * (b.getDenominator() / tGCD2)};
+    }
+
+    /**
+     * @brief Sums xValues by recursively adding the sums of both halves.
+     */
+    template <MathType Type>
+    [[nodiscard]] Fraction<Type> tree_sum_block(std::span<const Fraction<Type>> xValues)
+    {
+        if (xValues.empty())
+            return Fraction<Type>{Type(0), Type(1)};
+        if (xValues.size() == 1)
+            return Fraction<Type>{xValues.front()}.simplify();
+        const std::size_t tMiddle = xValues.size() / 2;
+        return add_reduced(tree_sum_block(xValues.first(tMiddle)), tree_sum_block(xValues.subspan(tMiddle)));
+    }
+
+    template <MathType Type>
+    void parallel_scan(std::span<const Fraction<Type>> xIn, std::span<Fraction<Type>> xOut, const Fraction<Type> &xInit, bool xInclusive,
+                       const FractionParallelOptions &xOptions) noexcept(false)
+    {
+        if (xIn.size() != xOut.size())
+            throw std::invalid_argument("Input and output must have the same size.");
+
+        const std::size_t tBlocks = block_count(xIn.size(), xOptions);
+        const std::size_t tBlockSize = (xIn.size() + tBlocks - 1) / std::max<std::size_t>(tBlocks, 1);
+        const auto tBlock = [&xIn, tBlockSize](std::size_t b)
+        {
+            const std::size_t tBegin = std::min(b * tBlockSize, xIn.size());
+            return std::pair{tBegin, std::min(tBlockSize, xIn.size() - tBegin)};
+        };
+
+        // Pass 1: exact sum of every block over the block's common denominator.
+        std::vector<Fraction<Type>> tSums(tBlocks, Fraction<Type>{Type(0), Type(1)});
+        if (tBlocks > 1)
+        {
+            for_each_block(tBlocks - 1,
+                           [&](std::size_t b)
+                           {
+                               const auto [tBegin, tCount] = tBlock(b);
+                               tSums[b] = scan_block<Type>(xIn.subspan(tBegin, tCount), {}, Fraction<Type>{Type(0), Type(1)}, true);
+                           });
+        }
+
+        // Sequential carry of the block offsets, only tBlocks additions.
+        std::vector<Fraction<Type>> tOffsets(tBlocks, xInit);
+        for (std::size_t b = 1; b < tBlocks; ++b)
+            tOffsets[b] = (tOffsets[b - 1] + tSums[b - 1]).simplify();
+
+        // Pass 2: rescan every block starting at its offset.
+        for_each_block(tBlocks,
+                       [&](std::size_t b)
+                       {
+                           const auto [tBegin, tCount] = tBlock(b);
+                           (void)scan_block<Type>(xIn.subspan(tBegin, tCount), xOut.subspan(tBegin, tCount), tOffsets[b], xInclusive);
+                       });
+    }
+}
+
+/**
+ * @brief Writes the running sums x0, x0 + x1, ... of xIn to xOut.
+ *
+ * Two-pass parallel scan: every block first computes its sum, the block offsets are carried
+ * sequentially and every block is then rescanned from its offset. Within a block all prefixes share
+ * the block's common denominator, so each step is one integer multiply-add instead of the LCM work of
+ * operator+=. Every output is simplified with a positive denominator.
+ *
+ * With built-in value types the common denominator of a block has to fit into Type.
+ *
+ * @param xIn The input fractions.
+ * @param xOut The output, same size as xIn; may alias xIn.
+ * @param xOptions Thread count and sequential cut-off.
+ * @exception std::invalid_argument - If the sizes differ.
+ */
+template <MathType Type>
+void inclusive_scan(std::span<const Fraction<Type>> xIn, std::span<Fraction<Type>> xOut, const FractionParallelOptions &xOptions = {}) noexcept(false)
+{
+    fraction_detail::parallel_scan<Type>(xIn, xOut, Fraction<Type>{Type(0), Type(1)}, true, xOptions);
+}
+
+/**
+ * @brief Writes xInit, xInit + x0, xInit + x0 + x1, ... to xOut (each prefix excludes its own element).
+ *
+ * Same algorithm as inclusive_scan().
+ *
+ * @param xIn The input fractions.
+ * @param xOut The output, same size as xIn; may alias xIn.
+ * @param xInit The value of the first output.
+ * @param xOptions Thread count and sequential cut-off.
+ * @exception std::invalid_argument - If the sizes differ.
+ */
+template <MathType Type>
+void exclusive_scan(std::span<const Fraction<Type>> xIn, std::span<Fraction<Type>> xOut, const Fraction<Type> &xInit,
+                    const FractionParallelOptions &xOptions = {}) noexcept(false)
+{
+    fraction_detail::parallel_scan<Type>(xIn, xOut, xInit, false, xOptions);
+}
+
+/**
+ * @brief Sums many fractions along a balanced binary tree.
+ *
+ * Adding n fractions with unrelated denominators one by one lets the running denominator grow in every
+ * step, so with a bignum value type every addition works on the largest operand: O(n^2) in total.
+ * Pairing neighbours instead keeps both operands of every addition about the same size, which gives a
+ * near-linear total cost with fast multiplication. Every node uses the reduced addition, so
+ * intermediate results stay canonical. Inputs above the sequential cut-off are split into one block
+ * per thread; the block sums are combined by the same tree.
+ *
+ * @param xValues The fractions to sum.
+ * @param xOptions Thread count and sequential cut-off.
+ * @return The simplified sum with a positive denominator, 0 for an empty input.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> tree_sum(std::span<const Fraction<Type>> xValues, const FractionParallelOptions &xOptions = {})
+{
+    const std::size_t tBlocks = fraction_detail::block_count(xValues.size(), xOptions);
+    if (tBlocks == 1)
+        return fraction_detail::tree_sum_block(xValues);
+
+    const std::size_t tBlockSize = (xValues.size() + tBlocks - 1) / tBlocks;
+    std::vector<Fraction<Type>> tSums(tBlocks, Fraction<Type>{Type(0), Type(1)});
+    fraction_detail::for_each_block(tBlocks,
+                                    [&](std::size_t b)
+                                    {
+                                        const std::size_t tBegin = std::min(xValues.size(), b * tBlockSize);
+                                        const std::size_t tCount = std::min(tBlockSize, xValues.size() - tBegin);
+                                        tSums[b] = fraction_detail::tree_sum_block(xValues.subspan(tBegin, tCount));
+                                    });
+    return fraction_detail::tree_sum_block(std::span<const Fraction<Type>>{tSums});
+}
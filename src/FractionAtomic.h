@@ -0,0 +1,498 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionAggregate.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace fraction_detail
+{
+    /// Assumed cache line size for padding shared state.
+    inline constexpr std::size_t kCacheLine = 64;
+
+    /**
+     * @brief Mutex on its own cache line.
+     */
+    struct alignas(kCacheLine) PaddedMutex
+    {
+        std::mutex mutex;
+    };
+
+    /**
+     * @brief Returns one of a fixed set of mutexes for xAddress, used where no wide enough CAS exists.
+     */
+    [[nodiscard]] inline std::mutex &stripe_lock(const void *xAddress) noexcept
+    {
+        static std::array<PaddedMutex, 64> sStripes;
+        const auto tHash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(xAddress)) * 0x9E3779B97F4A7C15ull;
+        return sStripes[static_cast<std::size_t>(tHash >> 58)].mutex;
+    }
+
+    /**
+     * @brief Numerator and denominator packed into one naturally aligned block for double-width CAS.
+     */
+    template <typename Type>
+    struct alignas(2 * sizeof(Type)) PackedFraction
+    {
+        Type numerator;
+        Type denominator;
+    };
+
+    enum class AtomicBackend
+    {
+        StdAtomic, ///< std::atomic<PackedFraction> is lock-free (up to 32-bit values).
+        Cas16,     ///< 64-bit values with cmpxchg16b through the __sync builtins (-mcx16).
+        Striped    ///< Striped mutexes.
+    };
+
+    template <typename Type>
+    [[nodiscard]] consteval AtomicBackend atomic_backend() noexcept
+    {
+        if constexpr (std::atomic<PackedFraction<Type>>::is_always_lock_free)
+            return AtomicBackend::StdAtomic;
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__)
+        else if constexpr (sizeof(PackedFraction<Type>) == 16)
+            return AtomicBackend::Cas16;
+#endif
+        else
+            return AtomicBackend::Striped;
+    }
+
+    /**
+     * @brief Returns the CPU the calling thread runs on, or a hash of its id where that is unknown.
+     */
+    [[nodiscard]] inline std::size_t current_cpu() noexcept
+    {
+#if defined(__linux__)
+        if (const int tCpu = sched_getcpu(); tCpu >= 0)
+            return static_cast<std::size_t>(tCpu);
+#endif
+        return std::hash<std::thread::id>{}(std::this_thread::get_id());
+    }
+}
+
+/**
+ * @brief Fraction that many threads can update concurrently.
+ *
+ * Numerator and denominator are packed into one double-width word and updated with a single
+ * compare-and-swap, so readers always see a consistent pair. Values up to 32 bits use std::atomic,
+ * 64-bit values use cmpxchg16b when the target has it (GCC/Clang with -mcx16) and otherwise fall back
+ * to a striped lock. is_lock_free() reports which one is in use.
+ *
+ * @tparam Type A built-in integer type with at most 64 bits.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+class AtomicFraction
+{
+    using Packed_t = fraction_detail::PackedFraction<Type>;
+    static constexpr fraction_detail::AtomicBackend kBackend = fraction_detail::atomic_backend<Type>();
+
+    struct StdStorage
+    {
+        std::atomic<Packed_t> value;
+    };
+    struct alignas(16) RawStorage
+    {
+        Packed_t value;
+    };
+    using Storage_t = std::conditional_t<kBackend == fraction_detail::AtomicBackend::StdAtomic, StdStorage, RawStorage>;
+
+    Storage_t mStorage; ///< The packed value.
+
+    [[nodiscard]] static constexpr Packed_t pack(const Fraction<Type> &xValue) noexcept
+    {
+        return {xValue.getNumerator(), xValue.getDenominator()};
+    }
+
+    [[nodiscard]] static Fraction<Type> unpack(const Packed_t &xValue) noexcept(false)
+    {
+        return Fraction<Type>{xValue.numerator, xValue.denominator};
+    }
+
+    [[nodiscard]] Packed_t loadPacked() const
+    {
+        if constexpr (kBackend == fraction_detail::AtomicBackend::StdAtomic)
+        {
+            return mStorage.value.load(std::memory_order_acquire);
+        }
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__)
+        else if constexpr (kBackend == fraction_detail::AtomicBackend::Cas16)
+        {
+            // A CAS that never matches a zero denominator is an atomic 16-byte read.
+            auto *tWord = const_cast<unsigned __int128 *>(reinterpret_cast<const unsigned __int128 *>(&mStorage.value));
+            const unsigned __int128 tValue = __sync_val_compare_and_swap(tWord, 0, 0);
+            return std::bit_cast<Packed_t>(tValue);
+        }
+#endif
+        else
+        {
+            std::lock_guard tLock{fraction_detail::stripe_lock(this)};
+            return mStorage.value;
+        }
+    }
+
+    [[nodiscard]] bool casPacked(Packed_t &xExpected, const Packed_t &xDesired)
+    {
+        if constexpr (kBackend == fraction_detail::AtomicBackend::StdAtomic)
+        {
+            return mStorage.value.compare_exchange_weak(xExpected, xDesired, std::memory_order_acq_rel, std::memory_order_acquire);
+        }
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__)
+        else if constexpr (kBackend == fraction_detail::AtomicBackend::Cas16)
+        {
+            auto *tWord = reinterpret_cast<unsigned __int128 *>(&mStorage.value);
+            const auto tExpected = std::bit_cast<unsigned __int128>(xExpected);
+            const unsigned __int128 tPrevious = __sync_val_compare_and_swap(tWord, tExpected, std::bit_cast<unsigned __int128>(xDesired));
+            if (tPrevious == tExpected)
+                return true;
+            xExpected = std::bit_cast<Packed_t>(tPrevious);
+            return false;
+        }
+#endif
+        else
+        {
+            std::lock_guard tLock{fraction_detail::stripe_lock(this)};
+            if (mStorage.value.numerator == xExpected.numerator && mStorage.value.denominator == xExpected.denominator)
+            {
+                mStorage.value = xDesired;
+                return true;
+            }
+            xExpected = mStorage.value;
+            return false;
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs the atomic with xValue, simplified.
+     */
+    explicit AtomicFraction(const Fraction<Type> &xValue = Fraction<Type>{Type(0), Type(1)})
+    {
+        auto tValue = xValue;
+        tValue.simplify();
+        if constexpr (kBackend == fraction_detail::AtomicBackend::StdAtomic)
+            mStorage.value.store(pack(tValue), std::memory_order_relaxed);
+        else
+            mStorage.value = pack(tValue);
+    }
+
+    AtomicFraction(const AtomicFraction &) = delete;
+    AtomicFraction &operator=(const AtomicFraction &) = delete;
+
+    /**
+     * @brief Returns true if updates do not take a lock.
+     */
+    [[nodiscard]] static constexpr bool is_lock_free() noexcept
+    {
+        return kBackend != fraction_detail::AtomicBackend::Striped;
+    }
+
+    [[nodiscard]] Fraction<Type> load() const noexcept(false)
+    {
+        return unpack(loadPacked());
+    }
+
+    void store(const Fraction<Type> &xValue)
+    {
+        auto tExpected = loadPacked();
+        while (!casPacked(tExpected, pack(xValue)))
+        {
+        }
+    }
+
+    /**
+     * @brief Replaces the value with xDesired if it still equals xExpected field by field.
+     * @param xExpected Receives the current value on failure.
+     */
+    bool compare_exchange(Fraction<Type> &xExpected, const Fraction<Type> &xDesired) noexcept(false)
+    {
+        auto tExpected = pack(xExpected);
+        if (casPacked(tExpected, pack(xDesired)))
+            return true;
+        xExpected = unpack(tExpected);
+        return false;
+    }
+
+    /**
+     * @brief Atomically adds xValue and returns the previous value; the stored sum is kept simplified.
+     */
+    Fraction<Type> fetch_add(const Fraction<Type> &xValue) noexcept(false)
+    {
+        auto tExpected = loadPacked();
+        while (true)
+        {
+            auto tSum = unpack(tExpected) + xValue;
+            tSum.simplify();
+            const auto tPrevious = tExpected;
+            if (casPacked(tExpected, pack(tSum)))
+                return unpack(tPrevious);
+        }
+    }
+
+    AtomicFraction &operator+=(const Fraction<Type> &xValue) noexcept(false)
+    {
+        (void)fetch_add(xValue);
+        return *this;
+    }
+};
+
+/**
+ * @brief Exact running total with one cache-line padded shard per thread slot.
+ *
+ * Each thread adds into the shard picked by its id; the shard lock is practically uncontended, so
+ * adds scale with the number of cores. total() merges the ExactSum of every shard.
+ */
+template <MathType Type>
+class ShardedFractionSum
+{
+    struct alignas(fraction_detail::kCacheLine) Shard
+    {
+        std::mutex mutex;
+        ExactSum<Type> sum;
+    };
+
+    std::vector<Shard> mShards; ///< One shard per thread slot.
+
+public:
+    /**
+     * @brief Constructs the accumulator with xShards shards, 0 selects std::thread::hardware_concurrency().
+     */
+    explicit ShardedFractionSum(std::size_t xShards = 0)
+        : mShards(xShards == 0 ? std::max<std::size_t>(1, std::thread::hardware_concurrency()) : xShards)
+    {
+    }
+
+    [[nodiscard]] std::size_t shards() const noexcept
+    {
+        return mShards.size();
+    }
+
+    /**
+     * @brief Adds xValue to the shard of the calling thread.
+     */
+    void add(const Fraction<Type> &xValue)
+    {
+        auto &tShard = mShards[std::hash<std::thread::id>{}(std::this_thread::get_id()) % mShards.size()];
+        std::lock_guard tLock{tShard.mutex};
+        tShard.sum.add(xValue);
+    }
+
+    /**
+     * @brief Returns the exact sum of all added values.
+     * @exception std::overflow_error - If the simplified sum does not fit into Type.
+     */
+    [[nodiscard]] Fraction<Type> total() noexcept(false)
+    {
+        ExactSum<Type> tTotal;
+        for (auto &tShard : mShards)
+        {
+            std::lock_guard tLock{tShard.mutex};
+            tTotal.merge(tShard.sum);
+        }
+        return tTotal.sum();
+    }
+};
+
+/**
+ * @brief Options of ConcurrentFractionTotal.
+ */
+struct ConcurrentTotalOptions
+{
+    std::size_t shards = 0;                      ///< Number of shards, 0 selects std::thread::hardware_concurrency().
+    std::chrono::milliseconds mergeInterval{10};       ///< Period of the background merge, 0 disables the merge thread.
+};
+
+/**
+ * @brief Exact running total for many writer threads with a lock-free snapshot read.
+ *
+ * Writers add into an ExactSum in the shard of the CPU they currently run on, so on a
+ * multi-socket machine a shard is mostly touched by the cores of one socket. Every shard is a
+ * separate cache-line aligned allocation made by the first thread that uses it, which places it on
+ * that thread's NUMA node under the default first-touch policy.
+ *
+ * A background thread drains the shards into the global total every mergeInterval and publishes
+ * the simplified total into an AtomicFraction. snapshot() reads that value without taking any lock;
+ * it lags behind the writers by at most one merge period. total() merges synchronously.
+ *
+ * A merge that overflows cannot be undone, so its exception is kept and rethrown by every later
+ * total() and snapshot() instead of escaping the merge thread.
+ *
+ * @tparam Type A built-in integer type with at most 64 bits.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+class ConcurrentFractionTotal
+{
+    struct alignas(fraction_detail::kCacheLine) Shard
+    {
+        std::mutex mutex;
+        ExactSum<Type> pending;
+    };
+
+    std::size_t mShardCount;                               ///< Number of shards.
+    std::unique_ptr<std::atomic<Shard *>[]> mShards;       ///< Lazily allocated shards.
+    std::mutex mMergeMutex;                                ///< Guards mTotal and mError.
+    ExactSum<Type> mTotal;                                 ///< Exact sum of all drained shards.
+    std::exception_ptr mError;                             ///< First merge failure, written once before mFailed.
+    std::atomic<bool> mFailed{false};                      ///< Set once a merge has failed.
+    AtomicFraction<Type> mSnapshot;                        ///< Last published total.
+    std::mutex mWakeMutex;                                 ///< Used by the merge thread to sleep.
+    std::condition_variable_any mWake;                     ///< Wakes the merge thread on stop.
+    std::jthread mMerger;                                  ///< Background merge thread.
+
+    [[nodiscard]] Shard &localShard()
+    {
+        auto &tSlot = mShards[fraction_detail::current_cpu() % mShardCount];
+        Shard *tShard = tSlot.load(std::memory_order_acquire);
+        if (tShard != nullptr)
+            return *tShard;
+
+        auto tNew = std::make_unique<Shard>();
+        if (tSlot.compare_exchange_strong(tShard, tNew.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+            return *tNew.release();
+        return *tShard;
+    }
+
+    /**
+     * @brief Moves the pending sums of all shards into mTotal and publishes the result.
+     *
+     * Runs on the merge thread, so a failure is recorded in mError instead of being thrown.
+     */
+    void merge() noexcept
+    {
+        std::lock_guard tMergeLock{mMergeMutex};
+        if (mFailed.load(std::memory_order_relaxed))
+            return;
+
+        try
+        {
+            for (std::size_t i = 0; i < mShardCount; ++i)
+            {
+                Shard *tShard = mShards[i].load(std::memory_order_acquire);
+                if (tShard == nullptr)
+                    continue;
+
+                ExactSum<Type> tPending;
+                {
+                    std::lock_guard tLock{tShard->mutex};
+                    std::swap(tPending, tShard->pending);
+                }
+                if (tPending.count() != 0)
+                    mTotal.merge(tPending);
+            }
+            mSnapshot.store(mTotal.sum());
+        }
+        catch (...)
+        {
+            mError = std::current_exception();
+            mFailed.store(true, std::memory_order_release);
+        }
+    }
+
+    void rethrowFailure() const noexcept(false)
+    {
+        if (mFailed.load(std::memory_order_acquire))
+            std::rethrow_exception(mError);
+    }
+
+public:
+    explicit ConcurrentFractionTotal(const ConcurrentTotalOptions &xOptions = {})
+        : mShardCount(xOptions.shards == 0 ? std::max<std::size_t>(1, std::thread::hardware_concurrency()) : xOptions.shards),
+          mShards(std::make_unique<std::atomic<Shard *>[]>(mShardCount))
+    {
+        if (xOptions.mergeInterval.count() > 0)
+        {
+            mMerger = std::jthread(
+                [this, tInterval = xOptions.mergeInterval](std::stop_token xStop)
+                {
+                    std::unique_lock tLock{mWakeMutex};
+                    while (!mWake.wait_for(tLock, xStop, tInterval, [] { return false; }))
+                    {
+                        if (xStop.stop_requested())
+                            break;
+                        tLock.unlock();
+                        merge();
+                        tLock.lock();
+                    }
+                });
+        }
+    }
+
+    ConcurrentFractionTotal(const ConcurrentFractionTotal &) = delete;
+    ConcurrentFractionTotal &operator=(const ConcurrentFractionTotal &) = delete;
+
+    ~ConcurrentFractionTotal()
+    {
+        if (mMerger.joinable())
+        {
+            mMerger.request_stop();
+            mMerger.join();
+        }
+        for (std::size_t i = 0; i < mShardCount; ++i)
+            delete mShards[i].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t shards() const noexcept
+    {
+        return mShardCount;
+    }
+
+    /**
+     * @brief Adds xValue to the shard of the calling thread's CPU.
+     * @exception std::overflow_error - If the reduced shard sum does not fit into WideProduct_t.
+     */
+    void add(const Fraction<Type> &xValue) noexcept(false)
+    {
+        auto &tShard = localShard();
+        std::lock_guard tLock{tShard.mutex};
+        tShard.pending.add(xValue);
+    }
+
+    ConcurrentFractionTotal &operator+=(const Fraction<Type> &xValue)
+    {
+        add(xValue);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the total published by the last merge without locking.
+     * @exception std::overflow_error - If an earlier merge failed because the total does not fit.
+     */
+    [[nodiscard]] Fraction<Type> snapshot() const noexcept(false)
+    {
+        rethrowFailure();
+        return mSnapshot.load();
+    }
+
+    /**
+     * @brief Merges all shards now and returns the simplified total of every completed add().
+     * @exception std::overflow_error - If this or an earlier merge failed because the total does not fit.
+     */
+    [[nodiscard]] Fraction<Type> total() noexcept(false)
+    {
+        merge();
+        rethrowFailure();
+        std::lock_guard tLock{mMergeMutex};
+        return mTotal.sum();
+    }
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Overflow-checked integer arithmetic shared by the exact algorithms.
+ *
+ * Built-in integers (including __int128) are checked with the compiler's overflow builtins where
+ * available; every other type is assumed not to overflow and uses its plain operators.
+ */
+namespace fraction_detail
+{
+    template <typename T>
+    inline constexpr bool is_builtin_integer_v = std::is_integral_v<T>
+#ifdef __SIZEOF_INT128__
+                                                 || std::is_same_v<T, __int128> || std::is_same_v<T, unsigned __int128>
+#endif
+        ;
+
+    /**
+     * @brief Stores a + b (or a - b) in xResult and returns true if it overflowed; custom types never overflow.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr bool add_overflows(const Type &a, const Type &b, bool xSubtract, Type &xResult) noexcept
+    {
+        if constexpr (is_builtin_integer_v<Type>)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return xSubtract ? __builtin_sub_overflow(a, b, &xResult) : __builtin_add_overflow(a, b, &xResult);
+#else
+            constexpr Type kMax = std::numeric_limits<Type>::max();
+            constexpr Type kMin = std::numeric_limits<Type>::lowest();
+            const bool tOverflow = xSubtract ? (b < 0 ? a > kMax + b : a < kMin + b) : (b > 0 ? a > kMax - b : a < kMin - b);
+            if (!tOverflow)
+                xResult = xSubtract ? Type(a - b) : Type(a + b);
+            return tOverflow;
+#endif
+        }
+        else
+        {
+            xResult = xSubtract ? a - b : a + b;
+            return false;
+        }
+    }
+
+    /**
+     * @brief Stores a * b in xResult and returns true if it overflowed; custom types never overflow.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr bool mul_overflows(const Type &a, const Type &b, Type &xResult) noexcept
+    {
+        if constexpr (is_builtin_integer_v<Type>)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_mul_overflow(a, b, &xResult);
+#else
+            constexpr Type kMax = std::numeric_limits<Type>::max();
+            constexpr Type kMin = std::numeric_limits<Type>::lowest();
+            const bool tOverflow =
+                a != 0 && b != 0 && (a > 0 ? (b > 0 ? a > kMax / b : b < kMin / a) : (b > 0 ? a < kMin / b : (std::is_signed_v<Type> && a < kMax / b)));
+            if (!tOverflow)
+                xResult = Type(a * b);
+            return tOverflow;
+#endif
+        }
+        else
+        {
+            xResult = a * b;
+            return false;
+        }
+    }
+
+    /**
+     * @brief Returns a + b.
+     * @exception std::overflow_error - If the sum does not fit into Type.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr Type checked_add(const Type &a, const Type &b) noexcept(false)
+    {
+        Type tResult{};
+        if (add_overflows(a, b, false, tResult))
+            throw std::overflow_error("Intermediate result does not fit into the value type.");
+        return tResult;
+    }
+
+    /**
+     * @brief Returns a - b.
+     * @exception std::overflow_error - If the difference does not fit into Type.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr Type checked_sub(const Type &a, const Type &b) noexcept(false)
+    {
+        Type tResult{};
+        if (add_overflows(a, b, true, tResult))
+            throw std::overflow_error("Intermediate result does not fit into the value type.");
+        return tResult;
+    }
+
+    /**
+     * @brief Returns a * b.
+     * @exception std::overflow_error - If the product does not fit into Type.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr Type checked_mul(const Type &a, const Type &b) noexcept(false)
+    {
+        Type tResult{};
+        if (mul_overflows(a, b, tResult))
+            throw std::overflow_error("Intermediate result does not fit into the value type.");
+        return tResult;
+    }
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionColumn.h"
+
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+
+namespace fraction_detail
+{
+    template <typename T>
+    struct is_ratio : std::false_type
+    {
+    };
+
+    template <std::intmax_t N, std::intmax_t D>
+    struct is_ratio<std::ratio<N, D>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_duration : std::false_type
+    {
+    };
+
+    template <typename Rep, typename Period>
+    struct is_duration<std::chrono::duration<Rep, Period>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief Returns round(xValue * Num / Den) in the widened type without floating point.
+     */
+    template <typename Type, std::intmax_t Num, std::intmax_t Den>
+    [[nodiscard]] constexpr Type scale_exact(const Type &xValue, RoundingMode xMode) noexcept
+    {
+        using Wide_t = WideProduct_t<Type>;
+        if constexpr (Den == 1)
+            return static_cast<Type>(static_cast<Wide_t>(xValue) * static_cast<Wide_t>(Num));
+        else
+            return static_cast<Type>(round_quotient(static_cast<Wide_t>(xValue) * static_cast<Wide_t>(Num), static_cast<Wide_t>(Den), xMode));
+    }
+}
+
+/**
+ * @brief Converts a std::ratio to a Fraction at compile time; std::ratio is already reduced.
+ */
+template <typename Ratio, MathType Type = std::intmax_t>
+    requires fraction_detail::is_ratio<typename Ratio::type>::value
+[[nodiscard]] constexpr Fraction<Type> ratio_to_Fraction() noexcept(false)
+{
+    return Fraction<Type>{static_cast<Type>(Ratio::num), static_cast<Type>(Ratio::den)};
+}
+
+/**
+ * @brief Returns the length of a duration in seconds as simplified fraction.
+ */
+template <MathType Type, typename Rep, typename Period>
+    requires std::is_integral_v<Rep>
+[[nodiscard]] constexpr Fraction<Type> duration_to_Fraction(const std::chrono::duration<Rep, Period> &xDuration) noexcept(false)
+{
+    return Fraction<Type>{static_cast<Type>(xDuration.count()) * static_cast<Type>(Period::num), static_cast<Type>(Period::den)}.simplify();
+}
+
+/**
+ * @brief Casts between integral durations exactly, with a selectable rounding mode.
+ *
+ * The conversion factor is reduced at compile time with std::ratio_divide, the tick count is scaled
+ * in WideProduct_t and rounded with one integer division. Unlike std::chrono::duration_cast the
+ * intermediate product does not overflow intmax_t and there is never a floating point step.
+ */
+template <typename ToDuration, typename Rep, typename Period>
+    requires(fraction_detail::is_duration<ToDuration>::value && std::is_integral_v<Rep> && std::is_integral_v<typename ToDuration::rep>)
+[[nodiscard]] constexpr ToDuration exact_duration_cast(const std::chrono::duration<Rep, Period> &xDuration,
+                                                       RoundingMode xMode = RoundingMode::TowardZero) noexcept
+{
+    using Factor = std::ratio_divide<Period, typename ToDuration::period>;
+    using Common_t = std::common_type_t<Rep, typename ToDuration::rep>;
+    return ToDuration{static_cast<typename ToDuration::rep>(
+        fraction_detail::scale_exact<Common_t, Factor::num, Factor::den>(static_cast<Common_t>(xDuration.count()), xMode))};
+}
+
+/**
+ * @brief Tick count of a clock with a runtime rational period, e.g. 1001/30000 s for NTSC video.
+ *
+ * std::chrono::duration fixes the period at compile time. This type keeps the period as a Fraction
+ * and counts integer ticks, so timestamps never drift no matter how many ticks are added; the
+ * conversion to seconds or to a std::chrono::duration is exact up to the requested rounding.
+ */
+template <IntegralMathType Type>
+class FractionDuration
+{
+    Type mTicks{0};                       ///< Number of ticks.
+    Fraction<Type> mPeriod{Type(1), Type(1)}; ///< Positive, simplified seconds per tick.
+
+public:
+    /**
+     * @brief Constructs a duration of xTicks ticks of xPeriod seconds each.
+     * @exception std::invalid_argument - If xPeriod is not positive.
+     */
+    constexpr explicit FractionDuration(const Fraction<Type> &xPeriod, const Type &xTicks = Type(0)) noexcept(false)
+        : mTicks{xTicks}, mPeriod{xPeriod}
+    {
+        mPeriod.simplify();
+        if (!(Type(0) < mPeriod.getNumerator()))
+            throw std::invalid_argument("Period must be positive.");
+    }
+
+    /**
+     * @brief Converts a std::chrono duration into ticks of xPeriod.
+     * @exception std::invalid_argument - If xPeriod is not positive.
+     */
+    template <typename Rep, typename Period>
+        requires std::is_integral_v<Rep>
+    [[nodiscard]] static constexpr FractionDuration from(const std::chrono::duration<Rep, Period> &xDuration, const Fraction<Type> &xPeriod,
+                                                         RoundingMode xMode = RoundingMode::TowardZero) noexcept(false)
+    {
+        FractionDuration tResult{xPeriod};
+        // ticks = count * Period / period = count * Period::num * pd / (Period::den * pn)
+        using Wide_t = WideProduct_t<Type>;
+        const Wide_t tNumerator = static_cast<Wide_t>(xDuration.count()) * static_cast<Wide_t>(Period::num) *
+                                  static_cast<Wide_t>(tResult.mPeriod.getDenominator());
+        const Wide_t tDenominator = static_cast<Wide_t>(Period::den) * static_cast<Wide_t>(tResult.mPeriod.getNumerator());
+        tResult.mTicks = static_cast<Type>(fraction_detail::round_quotient(tNumerator, tDenominator, xMode));
+        return tResult;
+    }
+
+    [[nodiscard]] constexpr const Type &ticks() const noexcept
+    {
+        return mTicks;
+    }
+
+    [[nodiscard]] constexpr const Fraction<Type> &period() const noexcept
+    {
+        return mPeriod;
+    }
+
+    /**
+     * @brief Returns the exact length in seconds.
+     */
+    [[nodiscard]] constexpr Fraction<Type> seconds() const noexcept(false)
+    {
+        return Fraction<Type>{mTicks * mPeriod.getNumerator(), mPeriod.getDenominator()}.simplify();
+    }
+
+    /**
+     * @brief Converts to a std::chrono duration, rounding the last tick with xMode.
+     */
+    template <typename ToDuration>
+        requires(fraction_detail::is_duration<ToDuration>::value && std::is_integral_v<typename ToDuration::rep>)
+    [[nodiscard]] constexpr ToDuration to_duration(RoundingMode xMode = RoundingMode::TowardZero) const noexcept
+    {
+        // count = ticks * pn * To::den / (pd * To::num)
+        using To = typename ToDuration::period;
+        using Wide_t = WideProduct_t<Type>;
+        const Wide_t tNumerator = static_cast<Wide_t>(mTicks) * static_cast<Wide_t>(mPeriod.getNumerator()) * static_cast<Wide_t>(To::den);
+        const Wide_t tDenominator = static_cast<Wide_t>(mPeriod.getDenominator()) * static_cast<Wide_t>(To::num);
+        return ToDuration{static_cast<typename ToDuration::rep>(fraction_detail::round_quotient(tNumerator, tDenominator, xMode))};
+    }
+
+    constexpr FractionDuration &operator+=(const Type &xTicks) noexcept
+    {
+        mTicks = mTicks + xTicks;
+        return *this;
+    }
+
+    constexpr FractionDuration &operator-=(const Type &xTicks) noexcept
+    {
+        mTicks = mTicks - xTicks;
+        return *this;
+    }
+
+    constexpr FractionDuration &operator++() noexcept
+    {
+        mTicks = mTicks + Type(1);
+        return *this;
+    }
+
+    /**
+     * @brief Compares the lengths exactly, also across different periods.
+     */
+    [[nodiscard]] constexpr friend std::strong_ordering operator<=>(const FractionDuration &lhs, const FractionDuration &rhs) noexcept(false)
+    {
+        const auto tLhs = lhs.seconds();
+        const auto tRhs = rhs.seconds();
+        const int tOrder = fraction_detail::cross_compare(tLhs.getNumerator(), tLhs.getDenominator(), tRhs.getNumerator(), tRhs.getDenominator());
+        return tOrder <=> 0;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const FractionDuration &lhs, const FractionDuration &rhs) noexcept(false)
+    {
+        return (lhs <=> rhs) == 0;
+    }
+};
@@ -0,0 +1,560 @@
+#pragma once
+
+#include "Fraction.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace fraction_detail
+{
+    template <typename Type>
+    struct WideProduct
+    {
+        using type = Type;
+    };
+
+    template <typename Type>
+        requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::int32_t))
+    struct WideProduct<Type>
+    {
+        using type = std::conditional_t<std::is_signed_v<Type>, std::int64_t, std::uint64_t>;
+    };
+
+#ifdef __SIZEOF_INT128__
+    template <typename Type>
+        requires(std::is_integral_v<Type> && sizeof(Type) == sizeof(std::int64_t))
+    struct WideProduct<Type>
+    {
+        using type = std::conditional_t<std::is_signed_v<Type>, __int128, unsigned __int128>;
+    };
+#endif
+}
+
+/**
+ * @brief Integer type that holds the product of two Type values without overflow.
+ *
+ * Built-in integers up to 32 bits widen to 64 bits, 64-bit integers to __int128 (if available).
+ * Every other type multiplies in itself.
+ */
+template <typename Type>
+using WideProduct_t = typename fraction_detail::WideProduct<Type>::type;
+
+/**
+ * @brief Column of fractions in structure-of-arrays layout.
+ *
+ * Numerators and denominators live in two contiguous arrays, so batch kernels stream over plain
+ * integers and the compiler can vectorize them.
+ */
+template <MathType Type>
+class FractionColumn
+{
+    std::vector<Type> mNumerators{};   ///< Numerator per row.
+    std::vector<Type> mDenominators{}; ///< Denominator per row.
+
+public:
+    FractionColumn() = default;
+
+    /**
+     * @brief Constructs a column from separate numerator and denominator arrays.
+     * @exception std::invalid_argument - If the sizes differ or a denominator is 0.
+     */
+    FractionColumn(std::vector<Type> xNumerators, std::vector<Type> xDenominators) noexcept(false)
+        : mNumerators{std::move(xNumerators)}, mDenominators{std::move(xDenominators)}
+    {
+        if (mNumerators.size() != mDenominators.size())
+            throw std::invalid_argument("Numerators and denominators must have the same size.");
+        for (const auto &tDenominator : mDenominators)
+        {
+            if (tDenominator == 0)
+                throw std::invalid_argument("Denominator must be unequal zero!");
+        }
+    }
+
+    /**
+     * @brief Constructs a column from an array of fractions.
+     */
+    explicit FractionColumn(std::span<const Fraction<Type>> xValues)
+    {
+        reserve(xValues.size());
+        for (const auto &tValue : xValues)
+            push_back(tValue);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return mNumerators.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return mNumerators.empty();
+    }
+
+    void reserve(std::size_t xSize)
+    {
+        mNumerators.reserve(xSize);
+        mDenominators.reserve(xSize);
+    }
+
+    void push_back(const Fraction<Type> &xValue)
+    {
+        mNumerators.push_back(xValue.getNumerator());
+        mDenominators.push_back(xValue.getDenominator());
+    }
+
+    /**
+     * @brief Returns row xIndex as Fraction.
+     */
+    [[nodiscard]] Fraction<Type> operator[](std::size_t xIndex) const
+    {
+        return Fraction<Type>{mNumerators[xIndex], mDenominators[xIndex]};
+    }
+
+    [[nodiscard]] std::span<const Type> getNumerators() const noexcept
+    {
+        return mNumerators;
+    }
+
+    [[nodiscard]] std::span<Type> getNumerators() noexcept
+    {
+        return mNumerators;
+    }
+
+    [[nodiscard]] std::span<const Type> getDenominators() const noexcept
+    {
+        return mDenominators;
+    }
+
+    [[nodiscard]] std::span<Type> getDenominators() noexcept
+    {
+        return mDenominators;
+    }
+};
+
+/**
+ * @brief Comparison applied by scan_compare().
+ */
+enum class FractionCompare
+{
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Exact three-way comparison of n1/d1 and n2/d2 by widened cross-multiplication.
+     * @return -1, 0 or 1. Written without branches so loops over it vectorize for types of up to 32 bits.
+     */
+    template <typename Type>
+    [[nodiscard]] constexpr int cross_compare(const Type &n1, const Type &d1, const Type &n2, const Type &d2) noexcept
+    {
+        using Wide_t = WideProduct_t<Type>;
+        const Wide_t tLhs = static_cast<Wide_t>(n1) * static_cast<Wide_t>(d2);
+        const Wide_t tRhs = static_cast<Wide_t>(n2) * static_cast<Wide_t>(d1);
+        const int tOrder = static_cast<int>(tLhs > tRhs) - static_cast<int>(tLhs < tRhs);
+        if constexpr (std::is_unsigned_v<Type>)
+        {
+            return tOrder;
+        }
+        else
+        {
+            // A negative product of the denominators flips the inequality.
+            const int tFlip = static_cast<int>(d1 < Type(0)) ^ static_cast<int>(d2 < Type(0));
+            return tOrder * (1 - 2 * tFlip);
+        }
+    }
+
+    template <FractionCompare Op>
+    [[nodiscard]] constexpr bool matches(int xOrder) noexcept
+    {
+        if constexpr (Op == FractionCompare::Less)
+            return xOrder < 0;
+        else if constexpr (Op == FractionCompare::LessEqual)
+            return xOrder <= 0;
+        else if constexpr (Op == FractionCompare::Greater)
+            return xOrder > 0;
+        else if constexpr (Op == FractionCompare::GreaterEqual)
+            return xOrder >= 0;
+        else if constexpr (Op == FractionCompare::Equal)
+            return xOrder == 0;
+        else
+            return xOrder != 0;
+    }
+
+    template <FractionCompare Op, typename Type>
+    void scan_compare_kernel(std::span<const Type> xNumerators, std::span<const Type> xDenominators, const Type &xNumerator, const Type &xDenominator,
+                             std::span<std::uint64_t> xMask) noexcept
+    {
+        const std::size_t tSize = xNumerators.size();
+        for (std::size_t tWord = 0; tWord * 64 < tSize; ++tWord)
+        {
+            const std::size_t tBegin = tWord * 64;
+            const std::size_t tCount = tSize - tBegin < 64 ? tSize - tBegin : 64;
+            std::uint64_t tBits = 0;
+            for (std::size_t j = 0; j < tCount; ++j)
+            {
+                const int tOrder = cross_compare(xNumerators[tBegin + j], xDenominators[tBegin + j], xNumerator, xDenominator);
+                tBits |= static_cast<std::uint64_t>(matches<Op>(tOrder)) << j;
+            }
+            xMask[tWord] = tBits;
+        }
+    }
+}
+
+/**
+ * @brief Compares every row of a column against a constant fraction, e.g. price > 3/7.
+ *
+ * Uses exact cross-multiplication in WideProduct_t instead of converting to floating point, so the
+ * result is exact for the full value range of Type. The inner loop is branch-free and processes 64
+ * rows per mask word. For value types of up to 32 bits the products are 64-bit integers and the
+ * compiler vectorizes the loop for the target instruction set; 64-bit columns need __int128 products,
+ * which no SIMD instruction set provides, so their loop runs scalar (still without branches).
+ *
+ * @param xColumn The column to scan.
+ * @param xOp The comparison row OP constant.
+ * @param xConstant The constant fraction.
+ * @return Bitmask with bit (i % 64) of word (i / 64) set if row i matches.
+ */
+template <MathType Type>
+[[nodiscard]] std::vector<std::uint64_t> scan_compare(const FractionColumn<Type> &xColumn, FractionCompare xOp, const Fraction<Type> &xConstant)
+{
+    std::vector<std::uint64_t> tMask((xColumn.size() + 63) / 64, 0);
+    const auto tNumerators = xColumn.getNumerators();
+    const auto tDenominators = xColumn.getDenominators();
+    const auto &tNumerator = xConstant.getNumerator();
+    const auto &tDenominator = xConstant.getDenominator();
+
+    switch (xOp)
+    {
+    case FractionCompare::Less:
+        fraction_detail::scan_compare_kernel<FractionCompare::Less>(tNumerators, tDenominators, tNumerator, tDenominator, std::span{tMask});
+        break;
+    case FractionCompare::LessEqual:
+        fraction_detail::scan_compare_kernel<FractionCompare::LessEqual>(tNumerators, tDenominators, tNumerator, tDenominator, std::span{tMask});
+        break;
+    case FractionCompare::Greater:
+        fraction_detail::scan_compare_kernel<FractionCompare::Greater>(tNumerators, tDenominators, tNumerator, tDenominator, std::span{tMask});
+        break;
+    case FractionCompare::GreaterEqual:
+        fraction_detail::scan_compare_kernel<FractionCompare::GreaterEqual>(tNumerators, tDenominators, tNumerator, tDenominator, std::span{tMask});
+        break;
+    case FractionCompare::Equal:
+        fraction_detail::scan_compare_kernel<FractionCompare::Equal>(tNumerators, tDenominators, tNumerator, tDenominator, std::span{tMask});
+        break;
+    case FractionCompare::NotEqual:
+        fraction_detail::scan_compare_kernel<FractionCompare::NotEqual>(tNumerators, tDenominators, tNumerator, tDenominator, std::span{tMask});
+        break;
+    }
+    return tMask;
+}
+
+/**
+ * @brief Counts the rows selected by a bitmask from scan_compare().
+ */
+[[nodiscard]] inline std::size_t count_matches(std::span<const std::uint64_t> xMask) noexcept
+{
+    std::size_t tCount = 0;
+    for (const auto tWord : xMask)
+        tCount += static_cast<std::size_t>(std::popcount(tWord));
+    return tCount;
+}
+
+/**
+ * @brief Returns the index of the smallest fraction of the column, the first one on ties.
+ * @exception std::invalid_argument - If the column is empty.
+ */
+template <MathType Type>
+[[nodiscard]] std::size_t column_argmin(const FractionColumn<Type> &xColumn) noexcept(false)
+{
+    if (xColumn.empty())
+        throw std::invalid_argument("Column must not be empty.");
+
+    const auto tNumerators = xColumn.getNumerators();
+    const auto tDenominators = xColumn.getDenominators();
+    std::size_t tBest = 0;
+    for (std::size_t i = 1; i < xColumn.size(); ++i)
+    {
+        if (fraction_detail::cross_compare(tNumerators[i], tDenominators[i], tNumerators[tBest], tDenominators[tBest]) < 0)
+            tBest = i;
+    }
+    return tBest;
+}
+
+/**
+ * @brief Returns the index of the largest fraction of the column, the first one on ties.
+ * @exception std::invalid_argument - If the column is empty.
+ */
+template <MathType Type>
+[[nodiscard]] std::size_t column_argmax(const FractionColumn<Type> &xColumn) noexcept(false)
+{
+    if (xColumn.empty())
+        throw std::invalid_argument("Column must not be empty.");
+
+    const auto tNumerators = xColumn.getNumerators();
+    const auto tDenominators = xColumn.getDenominators();
+    std::size_t tBest = 0;
+    for (std::size_t i = 1; i < xColumn.size(); ++i)
+    {
+        if (fraction_detail::cross_compare(tNumerators[i], tDenominators[i], tNumerators[tBest], tDenominators[tBest]) > 0)
+            tBest = i;
+    }
+    return tBest;
+}
+
+/**
+ * @brief Returns the smallest fraction of the column.
+ * @exception std::invalid_argument - If the column is empty.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> column_min(const FractionColumn<Type> &xColumn) noexcept(false)
+{
+    return xColumn[column_argmin(xColumn)];
+}
+
+/**
+ * @brief Returns the largest fraction of the column.
+ * @exception std::invalid_argument - If the column is empty.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> column_max(const FractionColumn<Type> &xColumn) noexcept(false)
+{
+    return xColumn[column_argmax(xColumn)];
+}
+
+/**
+ * @brief Rounds every row of a column to an integer, see round(const Fraction &, RoundingMode).
+ * @param xOut Receives one integer per row.
+ * @exception std::invalid_argument - If xOut has a different size than the column.
+ */
+template <IntegralMathType Type>
+void column_round(const FractionColumn<Type> &xColumn, std::span<Type> xOut, RoundingMode xMode = RoundingMode::HalfUp) noexcept(false)
+{
+    if (xOut.size() != xColumn.size())
+        throw std::invalid_argument("Output must have the same size as the column.");
+
+    const auto tNumerators = xColumn.getNumerators();
+    const auto tDenominators = xColumn.getDenominators();
+    for (std::size_t i = 0; i < xOut.size(); ++i)
+        xOut[i] = fraction_detail::round_quotient(tNumerators[i], tDenominators[i], xMode);
+}
+
+/**
+ * @brief Writes floor() of every row to xOut.
+ * @exception std::invalid_argument - If xOut has a different size than the column.
+ */
+template <IntegralMathType Type>
+void column_floor(const FractionColumn<Type> &xColumn, std::span<Type> xOut) noexcept(false)
+{
+    column_round(xColumn, xOut, RoundingMode::Floor);
+}
+
+/**
+ * @brief Writes ceil() of every row to xOut.
+ * @exception std::invalid_argument - If xOut has a different size than the column.
+ */
+template <IntegralMathType Type>
+void column_ceil(const FractionColumn<Type> &xColumn, std::span<Type> xOut) noexcept(false)
+{
+    column_round(xColumn, xOut, RoundingMode::Ceiling);
+}
+
+/**
+ * @brief Writes trunc() of every row to xOut, a plain element-wise division the compiler can vectorize.
+ * @exception std::invalid_argument - If xOut has a different size than the column.
+ */
+template <IntegralMathType Type>
+void column_trunc(const FractionColumn<Type> &xColumn, std::span<Type> xOut) noexcept(false)
+{
+    if (xOut.size() != xColumn.size())
+        throw std::invalid_argument("Output must have the same size as the column.");
+
+    const auto tNumerators = xColumn.getNumerators();
+    const auto tDenominators = xColumn.getDenominators();
+    for (std::size_t i = 0; i < xOut.size(); ++i)
+        xOut[i] = tNumerators[i] / tDenominators[i];
+}
+
+namespace fraction_detail
+{
+    template <typename Type>
+    [[nodiscard]] constexpr std::uint64_t magnitude_u64(const Type &xValue) noexcept
+    {
+        if constexpr (std::is_signed_v<Type>)
+            return xValue < 0 ? std::uint64_t(0) - static_cast<std::uint64_t>(xValue) : static_cast<std::uint64_t>(xValue);
+        else
+            return static_cast<std::uint64_t>(xValue);
+    }
+
+    /**
+     * @brief Returns xNumerator / xDenominator correctly rounded to double, for any 64-bit magnitudes.
+     *
+     * The quotient is computed to 55 or 56 bits by one integer division, the remainder serves as
+     * sticky bit, and the result is rounded half to even once.
+     */
+    [[nodiscard]] inline double quotient_to_double(std::uint64_t xNumerator, std::uint64_t xDenominator, bool xNegative) noexcept
+    {
+        if (xNumerator == 0)
+            return xNegative ? -0.0 : 0.0;
+#ifdef __SIZEOF_INT128__
+        const int tShift = 55 + std::bit_width(xDenominator) - std::bit_width(xNumerator);
+        unsigned __int128 tNumerator = xNumerator;
+        unsigned __int128 tDenominator = xDenominator;
+        if (tShift >= 0)
+            tNumerator <<= tShift;
+        else
+            tDenominator <<= -tShift;
+
+        // 2^54 < tQuotient < 2^56
+        const auto tQuotient = static_cast<std::uint64_t>(tNumerator / tDenominator);
+        const bool tSticky = tNumerator % tDenominator != 0;
+        const int tDrop = std::bit_width(tQuotient) - 53;
+        std::uint64_t tMantissa = tQuotient >> tDrop;
+        const std::uint64_t tRest = tQuotient & ((std::uint64_t(1) << tDrop) - 1);
+        const std::uint64_t tHalf = std::uint64_t(1) << (tDrop - 1);
+        if (tRest > tHalf || (tRest == tHalf && (tSticky || (tMantissa & 1) != 0)))
+            ++tMantissa;
+        const double tResult = std::ldexp(static_cast<double>(tMantissa), tDrop - tShift);
+#else
+        const auto tResult = static_cast<double>(static_cast<long double>(xNumerator) / static_cast<long double>(xDenominator));
+#endif
+        return xNegative ? -tResult : tResult;
+    }
+}
+
+/**
+ * @brief Converts every row of a column to the correctly rounded double.
+ *
+ * The main loop is the plain element-wise division, which the compiler vectorizes. It is already
+ * correctly rounded whenever numerator and denominator convert to double exactly, i.e. for
+ * magnitudes up to 2^53. For 64-bit types every block of 64 rows is checked for larger magnitudes
+ * with an OR reduction of the biased values, and only those rows are recomputed exactly.
+ * Fraction::to_double() rounds twice on such rows. The int64 to double conversion needs AVX-512DQ
+ * on x86-64; with older instruction sets only the check vectorizes.
+ *
+ * @exception std::invalid_argument - If xOut has a different size than the column.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+void column_to_double(const FractionColumn<Type> &xColumn, std::span<double> xOut) noexcept(false)
+{
+    if (xOut.size() != xColumn.size())
+        throw std::invalid_argument("Output must have the same size as the column.");
+
+    const auto tNumerators = xColumn.getNumerators();
+    const auto tDenominators = xColumn.getDenominators();
+    for (std::size_t i = 0; i < xOut.size(); ++i)
+        xOut[i] = static_cast<double>(tNumerators[i]) / static_cast<double>(tDenominators[i]);
+
+    if constexpr (std::numeric_limits<Type>::digits > std::numeric_limits<double>::digits)
+    {
+        // Biased so that every value in [-2^53, 2^53) (unsigned: [0, 2^53)) has no bit at kShift or above;
+        // 2^53 itself is recomputed as well, which is exact but not needed.
+        constexpr std::uint64_t kExact = std::uint64_t(1) << std::numeric_limits<double>::digits;
+        constexpr int kShift = std::numeric_limits<double>::digits + (std::is_signed_v<Type> ? 1 : 0);
+        const auto tBiased = [](const Type &xValue) { return static_cast<std::uint64_t>(xValue) + (std::is_signed_v<Type> ? kExact : 0); };
+        const auto tInexact = [&tBiased](const Type &xValue) { return (tBiased(xValue) >> kShift) != 0; };
+
+        for (std::size_t tBegin = 0; tBegin < xOut.size(); tBegin += 64)
+        {
+            const std::size_t tEnd = std::min(xOut.size(), tBegin + 64);
+            std::uint64_t tBits = 0;
+            for (std::size_t i = tBegin; i < tEnd; ++i)
+                tBits |= tBiased(tNumerators[i]) | tBiased(tDenominators[i]);
+            if ((tBits >> kShift) == 0)
+                continue;
+
+            for (std::size_t i = tBegin; i < tEnd; ++i)
+            {
+                if (tInexact(tNumerators[i]) || tInexact(tDenominators[i]))
+                {
+                    bool tNegative = false;
+                    if constexpr (std::is_signed_v<Type>)
+                        tNegative = (tNumerators[i] < 0) != (tDenominators[i] < 0);
+                    xOut[i] = fraction_detail::quotient_to_double(fraction_detail::magnitude_u64(tNumerators[i]),
+                                                                  fraction_detail::magnitude_u64(tDenominators[i]), tNegative);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Converts doubles to the closest fractions with a denominator of at most xMaxDenominator.
+ *
+ * Every finite double is exactly m * 2^e. The main loop decodes that dyadic value with bit
+ * operations only; when it fits into Type with a denominator up to xMaxDenominator, it is the
+ * exact result. The remaining values are recomputed by to_Fraction_bounded(), so the row equals
+ * to_Fraction_bounded(x, xMaxDenominator) in every case, and the iterative continued fraction only
+ * runs where an approximation is really needed.
+ *
+ * @exception std::invalid_argument - If a value is not finite or xMaxDenominator is less than 1.
+ * @exception std::overflow_error - If a value does not fit into Type.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+[[nodiscard]] FractionColumn<Type> column_from_double(std::span<const double> xValues,
+                                                      Type xMaxDenominator = std::numeric_limits<Type>::max()) noexcept(false)
+{
+    if (xMaxDenominator < Type(1))
+        throw std::invalid_argument("Maximal denominator must be at least 1.");
+
+    std::vector<Type> tNumerators(xValues.size());
+    std::vector<Type> tDenominators(xValues.size());
+    std::vector<std::size_t> tFixups;
+
+    // Largest power of two allowed as denominator and largest magnitude of the numerator.
+    const int tMaxShift = std::bit_width(static_cast<std::uint64_t>(xMaxDenominator)) - 1;
+    constexpr int kNumeratorBits = std::numeric_limits<Type>::digits;
+
+    for (std::size_t i = 0; i < xValues.size(); ++i)
+    {
+        const auto tBits = std::bit_cast<std::uint64_t>(xValues[i]);
+        const bool tNegative = (tBits >> 63) != 0;
+        const int tExponent = static_cast<int>((tBits >> 52) & 0x7FF);
+        const std::uint64_t tFraction = tBits & ((std::uint64_t(1) << 52) - 1);
+
+        // x = tMantissa * 2^tPower, then trailing zero bits of the mantissa cancel against the denominator.
+        const std::uint64_t tMantissa = tExponent == 0 ? tFraction : tFraction | (std::uint64_t(1) << 52);
+        int tPower = (tExponent == 0 ? 1 : tExponent) - 1075;
+        const int tCancel = tPower < 0 ? std::min(std::countr_zero(tMantissa | (std::uint64_t(1) << 63)), -tPower) : 0;
+        const std::uint64_t tReduced = tMantissa >> tCancel;
+        tPower += tCancel;
+
+        const int tWidth = std::bit_width(tReduced) + (tPower > 0 ? tPower : 0);
+        // A signed Type also holds -2^digits, the one magnitude with digits + 1 bits.
+        const bool tLowest = std::is_signed_v<Type> && tNegative && tWidth == kNumeratorBits + 1 && std::has_single_bit(tReduced);
+        const bool tFits = tExponent != 0x7FF && (tReduced == 0 || ((tWidth <= kNumeratorBits || tLowest) && -tPower <= tMaxShift)) &&
+                           (std::is_signed_v<Type> || !tNegative || tReduced == 0);
+        if (!tFits)
+        {
+            tFixups.push_back(i);
+            continue;
+        }
+
+        // Negated in unsigned arithmetic, so -2^digits wraps to Type's lowest value.
+        const std::uint64_t tMagnitude = tPower > 0 ? tReduced << tPower : tReduced;
+        tNumerators[i] = static_cast<Type>(tNegative ? std::uint64_t(0) - tMagnitude : tMagnitude);
+        tDenominators[i] = tReduced == 0 || tPower >= 0 ? Type(1) : static_cast<Type>(Type(1) << -tPower);
+    }
+
+    for (const auto i : tFixups)
+    {
+        const auto tValue = to_Fraction_bounded(xValues[i], xMaxDenominator);
+        tNumerators[i] = tValue.getNumerator();
+        tDenominators[i] = tValue.getDenominator();
+    }
+    return FractionColumn<Type>{std::move(tNumerators), std::move(tDenominators)};
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionModular.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Shape of the decimal expansion of a fraction: sign, integer part, pre-period and repetend length.
+ *
+ * 1/6 = 0.1(6) has preperiod 1 and period 1, 1/8 = 0.125 has preperiod 3 and period 0.
+ */
+struct DecimalExpansion
+{
+    bool negative;
+    std::uint64_t integerPart;
+    std::uint64_t preperiod;
+    std::uint64_t period;
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief |x| = integer + remainder / divisor with remainder / divisor reduced.
+     */
+    struct DecimalParts
+    {
+        bool negative;
+        std::uint64_t integer;
+        std::uint64_t remainder;
+        std::uint64_t divisor;
+    };
+
+    template <typename Type>
+    [[nodiscard]] constexpr std::uint64_t decimal_magnitude(const Type &xValue) noexcept
+    {
+        using Unsigned_t = std::make_unsigned_t<Type>;
+        if constexpr (std::is_signed_v<Type>)
+        {
+            if (xValue < 0)
+                return static_cast<std::uint64_t>(static_cast<Unsigned_t>(Unsigned_t(0) - static_cast<Unsigned_t>(xValue)));
+        }
+        return static_cast<std::uint64_t>(static_cast<Unsigned_t>(xValue));
+    }
+
+    template <typename Type>
+    [[nodiscard]] constexpr DecimalParts decimal_parts(const Fraction<Type> &xValue) noexcept
+    {
+        std::uint64_t tNumerator = decimal_magnitude(xValue.getNumerator());
+        std::uint64_t tDenominator = decimal_magnitude(xValue.getDenominator());
+        bool tNegative = false;
+        if constexpr (std::is_signed_v<Type>)
+            tNegative = (xValue.getNumerator() < 0) != (xValue.getDenominator() < 0) && tNumerator != 0;
+
+        const std::uint64_t tGCD = fraction_GCD(tNumerator, tDenominator);
+        tNumerator /= tGCD;
+        tDenominator /= tGCD;
+        return {tNegative, tNumerator / tDenominator, tNumerator % tDenominator, tDenominator};
+    }
+
+    /**
+     * @brief Returns the next digit floor(10 r / d) and replaces r by 10 r mod d, for every d without overflow.
+     */
+    [[nodiscard]] constexpr unsigned next_digit(std::uint64_t &r, std::uint64_t d) noexcept
+    {
+        if (r <= std::numeric_limits<std::uint64_t>::max() / 10)
+        {
+            const std::uint64_t tValue = r * 10;
+            r = tValue % d;
+            return static_cast<unsigned>(tValue / d);
+        }
+        // Ten modular additions of r, every wrap around d is one unit of the digit.
+        unsigned tDigit = 0;
+        std::uint64_t tSum = 0;
+        for (int i = 0; i < 10; ++i)
+        {
+            if (tSum >= d - r)
+            {
+                tSum -= d - r;
+                ++tDigit;
+            }
+            else
+            {
+                tSum += r;
+            }
+        }
+        r = tSum;
+        return tDigit;
+    }
+
+    /**
+     * @brief Writes the digits of the reduced fraction xRemainder / xDivisor from position xFirst after the point on.
+     *
+     * Jumps to position xFirst with one modular power, so late digits of a long repetend cost
+     * O(log xFirst) instead of xFirst long division steps.
+     */
+    inline void write_digits(std::uint64_t xRemainder, std::uint64_t xDivisor, std::uint64_t xFirst, std::span<char> xOut) noexcept
+    {
+        std::uint64_t r = xFirst == 0 ? xRemainder : mod_mul(xRemainder, mod_pow(10, xFirst, xDivisor), xDivisor);
+        for (auto &tChar : xOut)
+            tChar = static_cast<char>('0' + next_digit(r, xDivisor));
+    }
+}
+
+/**
+ * @brief Calculates the shape of the decimal expansion without generating any digit.
+ *
+ * For the reduced denominator d = 2^a 5^b m with gcd(m, 10) = 1 the pre-period has max(a, b) digits
+ * and the repetend is as long as the multiplicative order of 10 modulo m. The order is derived from
+ * the factorization of m, so even repetends with billions of digits are measured in microseconds.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+[[nodiscard]] DecimalExpansion decimal_expansion(const Fraction<Type> &xValue)
+{
+    const auto tParts = fraction_detail::decimal_parts(xValue);
+
+    std::uint64_t m = tParts.divisor;
+    const auto tTwos = static_cast<std::uint64_t>(std::countr_zero(m));
+    m >>= tTwos;
+    std::uint64_t tFives = 0;
+    for (; m % 5 == 0; m /= 5)
+        ++tFives;
+
+    return {tParts.negative, tParts.integer, std::max(tTwos, tFives), m == 1 ? 0 : multiplicative_order(10 % m, m)};
+}
+
+/**
+ * @brief Writes xOut.size() digits of the expansion after the decimal point, starting at digit index xFirst.
+ *
+ * Digits past the end of a terminating expansion are '0'. Index 0 is the first digit after the point.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+void decimal_digits(const Fraction<Type> &xValue, std::uint64_t xFirst, std::span<char> xOut) noexcept
+{
+    const auto tParts = fraction_detail::decimal_parts(xValue);
+    fraction_detail::write_digits(tParts.remainder, tParts.divisor, xFirst, xOut);
+}
+
+/**
+ * @brief Returns the exact decimal representation with the repetend in parentheses, e.g. "-1.1(6)".
+ * @param xMaxDigits Maximal number of digits after the decimal point.
+ * @exception std::length_error - If pre-period and repetend together are longer than xMaxDigits.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+[[nodiscard]] std::string to_decimal_string(const Fraction<Type> &xValue, std::size_t xMaxDigits = 1024) noexcept(false)
+{
+    const auto tExpansion = decimal_expansion(xValue);
+    if (tExpansion.preperiod > xMaxDigits || tExpansion.period > xMaxDigits - tExpansion.preperiod)
+        throw std::length_error("Decimal expansion is longer than the requested maximum.");
+
+    std::string tResult = tExpansion.negative ? "-" : "";
+    tResult += std::to_string(tExpansion.integerPart);
+    if (tExpansion.preperiod + tExpansion.period == 0)
+        return tResult;
+
+    const auto tParts = fraction_detail::decimal_parts(xValue);
+    std::string tDigits(static_cast<std::size_t>(tExpansion.preperiod + tExpansion.period), '0');
+    fraction_detail::write_digits(tParts.remainder, tParts.divisor, 0, tDigits);
+
+    tResult += '.';
+    tResult.append(tDigits, 0, static_cast<std::size_t>(tExpansion.preperiod));
+    if (tExpansion.period != 0)
+    {
+        tResult += '(';
+        tResult.append(tDigits, static_cast<std::size_t>(tExpansion.preperiod));
+        tResult += ')';
+    }
+    return tResult;
+}
+
+/**
+ * @brief Returns the value rounded to exactly xDigits digits after the decimal point, e.g. "3.14".
+ * @param xMode How the discarded digits are rounded, see RoundingMode.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+[[nodiscard]] std::string round_decimal(const Fraction<Type> &xValue, std::size_t xDigits, RoundingMode xMode = RoundingMode::HalfEven)
+{
+    const auto tParts = fraction_detail::decimal_parts(xValue);
+    std::string tDigits = std::to_string(tParts.integer);
+    const std::size_t tIntegerDigits = tDigits.size();
+    tDigits.resize(tIntegerDigits + xDigits);
+    fraction_detail::write_digits(tParts.remainder, tParts.divisor, 0, std::span<char>{tDigits}.subspan(tIntegerDigits));
+
+    // Remainder behind the last kept digit.
+    const std::uint64_t tRest =
+        tParts.divisor == 1 ? 0 : mod_mul(tParts.remainder, mod_pow(10, static_cast<std::uint64_t>(xDigits), tParts.divisor), tParts.divisor);
+    const bool tOdd = ((tDigits.back() - '0') & 1) != 0;
+    if (fraction_detail::round_away(xMode, tParts.negative, tOdd, tRest, tParts.divisor))
+    {
+        auto tIt = tDigits.rbegin();
+        for (; tIt != tDigits.rend() && *tIt == '9'; ++tIt)
+            *tIt = '0';
+        if (tIt == tDigits.rend())
+            tDigits.insert(tDigits.begin(), '1');
+        else
+            ++*tIt;
+    }
+
+    const std::size_t tPoint = tDigits.size() - xDigits;
+    std::string tResult = tParts.negative && tDigits.find_first_not_of('0') != std::string::npos ? "-" : "";
+    tResult.append(tDigits, 0, tPoint);
+    if (xDigits > 0)
+    {
+        tResult += '.';
+        tResult.append(tDigits, tPoint);
+    }
+    return tResult;
+}
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "Fraction.h"
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace fraction_detail
+{
+    /**
+     * @brief Returns the upper half of the full product of two unsigned words.
+     */
+    template <typename Unsigned_t>
+    [[nodiscard]] constexpr Unsigned_t mul_high(Unsigned_t a, Unsigned_t b) noexcept
+    {
+        if constexpr (sizeof(Unsigned_t) <= sizeof(std::uint32_t))
+        {
+            return static_cast<Unsigned_t>((static_cast<std::uint64_t>(a) * b) >> (8 * sizeof(Unsigned_t)));
+        }
+        else
+        {
+#ifdef __SIZEOF_INT128__
+            return static_cast<Unsigned_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+            const std::uint64_t tALow = a & 0xFFFFFFFFu, tAHigh = a >> 32;
+            const std::uint64_t tBLow = b & 0xFFFFFFFFu, tBHigh = b >> 32;
+            const std::uint64_t tLowLow = tALow * tBLow;
+            const std::uint64_t tMiddle1 = tAHigh * tBLow + (tLowLow >> 32);
+            const std::uint64_t tMiddle2 = tALow * tBHigh + (tMiddle1 & 0xFFFFFFFFu);
+            return tAHigh * tBHigh + (tMiddle1 >> 32) + (tMiddle2 >> 32);
+#endif
+        }
+    }
+
+    /**
+     * @brief Calculates floor(2^(W + xShift) / xDivisor) and the remainder for a W-bit divisor, xShift < W.
+     */
+    template <typename Unsigned_t>
+    constexpr Unsigned_t wide_quotient(unsigned xShift, Unsigned_t xDivisor, Unsigned_t &xRemainder) noexcept
+    {
+        constexpr unsigned kBits = 8 * sizeof(Unsigned_t);
+        // Restoring long division of the (kBits + xShift + 1)-bit numerator 1 << (kBits + xShift).
+        Unsigned_t tQuotient = 0;
+        Unsigned_t tRemainder = 0;
+        for (unsigned i = kBits + xShift + 1; i-- > 0;)
+        {
+            const bool tCarry = (tRemainder >> (kBits - 1)) != 0;
+            tRemainder = static_cast<Unsigned_t>((tRemainder << 1) | (i == kBits + xShift ? 1u : 0u));
+            tQuotient = static_cast<Unsigned_t>(tQuotient << 1);
+            if (tCarry || tRemainder >= xDivisor)
+            {
+                tRemainder = static_cast<Unsigned_t>(tRemainder - xDivisor);
+                tQuotient |= 1;
+            }
+        }
+        xRemainder = tRemainder;
+        return tQuotient;
+    }
+}
+
+/**
+ * @brief Divisor with a precomputed multiply-high reciprocal for repeated division by the same value.
+ *
+ * Construction costs about one wide division, every division afterwards is one multiply-high, one
+ * subtraction and two shifts (Granlund-Montgomery, in the branch-free form used by libdivide).
+ * Worth it as soon as the same denominator or GCD divides more than a handful of values.
+ * Signed types divide the absolute values and truncate towards zero like the built-in operator.
+ *
+ * @tparam Type A built-in integer type with at most 64 bits.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+class FastDivisor
+{
+    using Unsigned_t = std::conditional_t<(sizeof(Type) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+
+    Type mDivisor;         ///< The divisor itself.
+    Unsigned_t mMagic{0};  ///< Reciprocal, 0 for powers of two.
+    unsigned mShift{0};    ///< Post shift.
+    bool mNegative{false}; ///< The divisor is negative.
+
+    /**
+     * @brief Returns |xValue| as unsigned word, also for the minimal value of signed types.
+     */
+    [[nodiscard]] static constexpr Unsigned_t magnitude(const Type &xValue) noexcept
+    {
+        using TypeUnsigned_t = std::make_unsigned_t<Type>;
+        if constexpr (std::is_signed_v<Type>)
+        {
+            if (xValue < 0)
+                return static_cast<Unsigned_t>(static_cast<TypeUnsigned_t>(TypeUnsigned_t(0) - static_cast<TypeUnsigned_t>(xValue)));
+        }
+        return static_cast<Unsigned_t>(static_cast<TypeUnsigned_t>(xValue));
+    }
+
+public:
+    /**
+     * @brief Precomputes the reciprocal of xDivisor.
+     * @exception std::invalid_argument - If xDivisor is 0.
+     */
+    constexpr explicit FastDivisor(const Type &xDivisor) noexcept(false)
+        : mDivisor{xDivisor}
+    {
+        if (xDivisor == 0)
+            throw std::invalid_argument("Divisor must be unequal zero!");
+
+        if constexpr (std::is_signed_v<Type>)
+            mNegative = xDivisor < 0;
+        const Unsigned_t tAbs = magnitude(xDivisor);
+
+        const auto tLog2 = static_cast<unsigned>(std::bit_width(tAbs) - 1);
+        mShift = tLog2;
+        if (std::has_single_bit(tAbs))
+            return;
+
+        Unsigned_t tRemainder = 0;
+        auto tMagic = fraction_detail::wide_quotient<Unsigned_t>(tLog2, tAbs, tRemainder);
+        // One more bit of precision than fits, the missing top bit is restored by the add in divide().
+        tMagic = static_cast<Unsigned_t>(tMagic + tMagic);
+        const auto tTwiceRemainder = static_cast<Unsigned_t>(tRemainder + tRemainder);
+        if (tTwiceRemainder >= tAbs || tTwiceRemainder < tRemainder)
+            ++tMagic;
+        mMagic = static_cast<Unsigned_t>(tMagic + 1);
+    }
+
+    [[nodiscard]] constexpr const Type &getDivisor() const noexcept
+    {
+        return mDivisor;
+    }
+
+    /**
+     * @brief Divides the unsigned magnitude xValue by |divisor|.
+     */
+    [[nodiscard]] constexpr Unsigned_t divideMagnitude(Unsigned_t xValue) const noexcept
+    {
+        if (mMagic == 0)
+            return static_cast<Unsigned_t>(xValue >> mShift);
+        const auto q = fraction_detail::mul_high(mMagic, xValue);
+        const auto t = static_cast<Unsigned_t>((static_cast<Unsigned_t>(xValue - q) >> 1) + q);
+        return static_cast<Unsigned_t>(t >> mShift);
+    }
+
+    /**
+     * @brief Returns xValue / divisor, truncated towards zero.
+     */
+    [[nodiscard]] constexpr Type divide(const Type &xValue) const noexcept
+    {
+        if constexpr (std::is_signed_v<Type>)
+        {
+            const bool tNegative = (xValue < 0) != mNegative;
+            const auto tQuotient = divideMagnitude(magnitude(xValue));
+            return static_cast<Type>(tNegative ? Unsigned_t(0) - tQuotient : tQuotient);
+        }
+        else
+        {
+            return static_cast<Type>(divideMagnitude(static_cast<Unsigned_t>(xValue)));
+        }
+    }
+
+    constexpr friend Type operator/(const Type &lhs, const FastDivisor &rhs) noexcept
+    {
+        return rhs.divide(lhs);
+    }
+
+    constexpr friend Type operator%(const Type &lhs, const FastDivisor &rhs) noexcept
+    {
+        return static_cast<Type>(lhs - rhs.divide(lhs) * rhs.mDivisor);
+    }
+};
+
+/**
+ * @brief Divides every value in place by the same divisor.
+ */
+template <typename Type>
+constexpr void divide_all(std::span<Type> xValues, const FastDivisor<Type> &xDivisor) noexcept
+{
+    for (auto &tValue : xValues)
+        tValue = xDivisor.divide(tValue);
+}
+
+/**
+ * @brief Brings every numerator of a column that shares xFrom as denominator onto the denominator xTo.
+ *
+ * xFrom has to divide xTo. The factor xTo / xFrom is computed once instead of once per value as
+ * operator+= does.
+ */
+template <typename Type>
+constexpr void rescale_all(std::span<Type> xNumerators, const Type &xFrom, const Type &xTo) noexcept
+{
+    const Type tFactor = xTo / xFrom;
+    for (auto &tValue : xNumerators)
+        tValue *= tFactor;
+}
+
+/**
+ * @brief Simplifies many fractions, reusing one FastDivisor while consecutive fractions share their GCD.
+ *
+ * GCDs come from the division-free fraction_GCD(). Columns with a repeated denominator usually
+ * repeat the GCD as well; once a GCD occurs twice in a row its reciprocal is cached and all further
+ * divisions by it are multiplications.
+ */
+template <typename Type>
+    requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+constexpr void simplify_all(std::span<Fraction<Type>> xValues) noexcept
+{
+    FastDivisor<Type> tCached{Type(1)};
+    Type tLast{1};
+
+    for (auto &tValue : xValues)
+    {
+        const Type tGCD = fraction_GCD(tValue.getNumerator(), tValue.getDenominator());
+        if (tGCD > 1 && tGCD == tCached.getDivisor())
+        {
+            tValue.getNumerator() = tCached.divide(tValue.getNumerator());
+            tValue.getDenominator() = tCached.divide(tValue.getDenominator());
+        }
+        else if (tGCD > 1)
+        {
+            if (tGCD == tLast)
+                tCached = FastDivisor<Type>{tGCD};
+            tLast = tGCD;
+            tValue.getNumerator() /= tGCD;
+            tValue.getDenominator() /= tGCD;
+        }
+
+        if constexpr (std::is_signed_v<Type>)
+        {
+            if (tValue.getDenominator() < 0)
+            {
+                tValue.getNumerator() = -tValue.getNumerator();
+                tValue.getDenominator() = -tValue.getDenominator();
+            }
+        }
+    }
+}
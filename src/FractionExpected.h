@@ -0,0 +1,306 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionChecked.h"
+
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#endif
+
+/**
+ * @brief Reason why an exception-free fraction operation failed.
+ */
+enum class FractionError
+{
+    ZeroDenominator, ///< A denominator is 0.
+    DivisionByZero,  ///< The divisor is a zero fraction.
+    Overflow,        ///< The result does not fit into the value type.
+    NotFinite,       ///< A floating point input is infinite or NaN.
+    InvalidArgument  ///< Any other invalid parameter.
+};
+
+/**
+ * @brief Returns a short English description of xError.
+ */
+[[nodiscard]] constexpr const char *fraction_error_message(FractionError xError) noexcept
+{
+    switch (xError)
+    {
+    case FractionError::ZeroDenominator:
+        return "Denominator must be unequal zero!";
+    case FractionError::DivisionByZero:
+        return "Division by a zero fraction.";
+    case FractionError::Overflow:
+        return "Result does not fit into the fraction's value type.";
+    case FractionError::NotFinite:
+        return "Value must be finite.";
+    case FractionError::InvalidArgument:
+        return "Invalid argument.";
+    }
+    return "Unknown error.";
+}
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+
+/**
+ * @brief Value or FractionError, std::expected where the standard library has it.
+ */
+template <typename Value>
+using FractionExpected = std::expected<Value, FractionError>;
+
+using FractionUnexpected = std::unexpected<FractionError>;
+
+/**
+ * @brief Exception thrown by FractionExpected::value() on an error.
+ */
+using FractionBadAccess = std::bad_expected_access<FractionError>;
+
+#else
+
+/**
+ * @brief Exception thrown by FractionExpected::value() on an error, like std::bad_expected_access.
+ */
+class FractionBadAccess : public std::exception
+{
+    FractionError mError; ///< The error.
+
+public:
+    explicit FractionBadAccess(FractionError xError) noexcept : mError{xError}
+    {
+    }
+
+    [[nodiscard]] const char *what() const noexcept override
+    {
+        return fraction_error_message(mError);
+    }
+
+    [[nodiscard]] FractionError error() const noexcept
+    {
+        return mError;
+    }
+};
+
+/**
+ * @brief Error wrapper that converts to a failed FractionExpected, like std::unexpected.
+ */
+struct FractionUnexpected
+{
+    FractionError mError; ///< The error.
+
+    constexpr explicit FractionUnexpected(FractionError xError) noexcept : mError{xError}
+    {
+    }
+
+    [[nodiscard]] constexpr FractionError error() const noexcept
+    {
+        return mError;
+    }
+};
+
+/**
+ * @brief Value or FractionError for standard libraries without std::expected.
+ *
+ * Provides the subset of std::expected used by this library, so code written against it compiles
+ * unchanged with both. value() on an error throws FractionBadAccess in both cases.
+ */
+template <typename Value>
+class FractionExpected
+{
+    std::optional<Value> mValue{};                       ///< The value, empty on error.
+    FractionError mError{FractionError::InvalidArgument}; ///< The error if mValue is empty.
+
+public:
+    using value_type = Value;
+    using error_type = FractionError;
+
+    constexpr FractionExpected(const Value &xValue) noexcept(std::is_nothrow_copy_constructible_v<Value>) : mValue{xValue}
+    {
+    }
+
+    constexpr FractionExpected(Value &&xValue) noexcept(std::is_nothrow_move_constructible_v<Value>) : mValue{std::move(xValue)}
+    {
+    }
+
+    constexpr FractionExpected(const FractionUnexpected &xError) noexcept : mError{xError.error()}
+    {
+    }
+
+    [[nodiscard]] constexpr bool has_value() const noexcept
+    {
+        return mValue.has_value();
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    [[nodiscard]] constexpr const Value &operator*() const noexcept
+    {
+        return *mValue;
+    }
+
+    [[nodiscard]] constexpr Value &operator*() noexcept
+    {
+        return *mValue;
+    }
+
+    [[nodiscard]] constexpr const Value *operator->() const noexcept
+    {
+        return &*mValue;
+    }
+
+    [[nodiscard]] constexpr Value *operator->() noexcept
+    {
+        return &*mValue;
+    }
+
+    /**
+     * @exception FractionBadAccess - If this holds an error.
+     */
+    [[nodiscard]] constexpr const Value &value() const noexcept(false)
+    {
+        if (!mValue)
+            throw FractionBadAccess{mError};
+        return *mValue;
+    }
+
+    [[nodiscard]] constexpr FractionError error() const noexcept
+    {
+        return mError;
+    }
+
+    template <typename Other>
+    [[nodiscard]] constexpr Value value_or(Other &&xDefault) const
+    {
+        return mValue ? *mValue : static_cast<Value>(std::forward<Other>(xDefault));
+    }
+};
+
+#endif
+
+namespace fraction_detail
+{
+    template <MathType Type>
+    [[nodiscard]] constexpr FractionExpected<Fraction<Type>> checked_sum(const Fraction<Type> &lhs, const Fraction<Type> &rhs, bool xSubtract) noexcept
+    {
+        if (lhs.getDenominator() == Type(0) || rhs.getDenominator() == Type(0))
+            return FractionUnexpected{FractionError::ZeroDenominator};
+
+        // Dividing out the common factor of the denominators first keeps the products small.
+        const Type tGCD = fraction_GCD(lhs.getDenominator(), rhs.getDenominator());
+        const Type tLhsScale = rhs.getDenominator() / tGCD;
+        const Type tRhsScale = lhs.getDenominator() / tGCD;
+        Type tLhs{};
+        Type tRhs{};
+        Type tNumerator{};
+        Type tDenominator{};
+        if (mul_overflows(lhs.getNumerator(), tLhsScale, tLhs) || mul_overflows(rhs.getNumerator(), tRhsScale, tRhs) ||
+            add_overflows(tLhs, tRhs, xSubtract, tNumerator) || mul_overflows(tRhsScale, rhs.getDenominator(), tDenominator))
+            return FractionUnexpected{FractionError::Overflow};
+        return Fraction<Type>::from_raw(tNumerator, tDenominator).simplify();
+    }
+}
+
+/**
+ * @brief Constructs a Fraction without exceptions.
+ * @return The fraction, or FractionError::ZeroDenominator.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr FractionExpected<Fraction<Type>> make_Fraction(const Type &xNumerator, const Type &xDenominator = Type(1)) noexcept
+{
+    if (xDenominator == Type(0))
+        return FractionUnexpected{FractionError::ZeroDenominator};
+    return Fraction<Type>::from_raw(xNumerator, xDenominator);
+}
+
+/**
+ * @brief Exception-free to_Fraction_bounded().
+ * @return The closest fraction with a denominator of at most xMaxDenominator, or FractionError::NotFinite,
+ * FractionError::InvalidArgument for xMaxDenominator < 1, or FractionError::Overflow.
+ */
+template <typename Arg_t, MathType Integral_t>
+    requires std::is_floating_point_v<Arg_t> && std::is_integral_v<Integral_t> && (sizeof(Integral_t) <= sizeof(std::uint64_t))
+[[nodiscard]] FractionExpected<Fraction<Integral_t>> try_to_Fraction(Arg_t xValue, Integral_t xMaxDenominator) noexcept
+{
+    if (!std::isfinite(xValue))
+        return FractionUnexpected{FractionError::NotFinite};
+    if (xMaxDenominator < Integral_t(1))
+        return FractionUnexpected{FractionError::InvalidArgument};
+
+    Integral_t tNumerator{0};
+    Integral_t tDenominator{1};
+    if (!fraction_detail::bounded_fraction(xValue, xMaxDenominator, tNumerator, tDenominator))
+        return FractionUnexpected{FractionError::Overflow};
+    return Fraction<Integral_t>::from_raw(tNumerator, tDenominator);
+}
+
+/**
+ * @brief Adds two fractions with overflow detection for built-in value types.
+ * @return The simplified sum, or FractionError::ZeroDenominator or FractionError::Overflow.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr FractionExpected<Fraction<Type>> checked_add(const Fraction<Type> &lhs, const Fraction<Type> &rhs) noexcept
+{
+    return fraction_detail::checked_sum(lhs, rhs, false);
+}
+
+/**
+ * @brief Subtracts two fractions with overflow detection for built-in value types.
+ * @return The simplified difference, or FractionError::ZeroDenominator or FractionError::Overflow.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr FractionExpected<Fraction<Type>> checked_sub(const Fraction<Type> &lhs, const Fraction<Type> &rhs) noexcept
+{
+    return fraction_detail::checked_sum(lhs, rhs, true);
+}
+
+/**
+ * @brief Multiplies two fractions with overflow detection for built-in value types.
+ *
+ * Cancels the cross GCDs before multiplying, so only products whose reduced result overflows fail.
+ *
+ * @return The simplified product, or FractionError::ZeroDenominator or FractionError::Overflow.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr FractionExpected<Fraction<Type>> checked_mul(const Fraction<Type> &lhs, const Fraction<Type> &rhs) noexcept
+{
+    if (lhs.getDenominator() == Type(0) || rhs.getDenominator() == Type(0))
+        return FractionUnexpected{FractionError::ZeroDenominator};
+
+    const Type tFirst = fraction_GCD(lhs.getNumerator(), rhs.getDenominator());
+    const Type tSecond = fraction_GCD(rhs.getNumerator(), lhs.getDenominator());
+    Type tNumerator{};
+    Type tDenominator{};
+    if (fraction_detail::mul_overflows(lhs.getNumerator() / tFirst, rhs.getNumerator() / tSecond, tNumerator) ||
+        fraction_detail::mul_overflows(lhs.getDenominator() / tSecond, rhs.getDenominator() / tFirst, tDenominator))
+        return FractionUnexpected{FractionError::Overflow};
+    return Fraction<Type>::from_raw(tNumerator, tDenominator).simplify();
+}
+
+/**
+ * @brief Divides two fractions with overflow detection for built-in value types.
+ *
+ * operator/= turns a division by a zero fraction into a zero denominator; this reports it instead.
+ *
+ * @return The simplified quotient, or FractionError::DivisionByZero, FractionError::ZeroDenominator or FractionError::Overflow.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr FractionExpected<Fraction<Type>> checked_div(const Fraction<Type> &lhs, const Fraction<Type> &rhs) noexcept
+{
+    // Checked before inverting, the reciprocal of n/0 would look like the valid fraction 0/n.
+    if (rhs.getDenominator() == Type(0))
+        return FractionUnexpected{FractionError::ZeroDenominator};
+    if (rhs.getNumerator() == Type(0))
+        return FractionUnexpected{FractionError::DivisionByZero};
+    return checked_mul(lhs, Fraction<Type>::from_raw(rhs.getDenominator(), rhs.getNumerator()));
+}
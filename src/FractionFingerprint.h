@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionModular.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+
+/**
+ * @brief Image of a fraction in Z/pZ for several primes p.
+ *
+ * A fingerprint supports the field operations in O(Count) word operations regardless of the size
+ * of the fraction it stands for. Two fingerprints from the same FingerprintContext compare equal if
+ * the fractions are equal; unequal fractions collide only with the probability described at
+ * FingerprintContext.
+ *
+ * @tparam Count Number of primes.
+ */
+template <std::size_t Count = 2>
+class Fingerprint
+{
+    const std::array<std::uint64_t, Count> *mPrimes{nullptr}; ///< Primes of the owning context.
+    std::array<std::uint64_t, Count> mResidues{};             ///< Residue per prime.
+
+public:
+    /**
+     * @brief Constructs a fingerprint from residues modulo the given primes.
+     */
+    constexpr Fingerprint(const std::array<std::uint64_t, Count> &xPrimes, const std::array<std::uint64_t, Count> &xResidues) noexcept
+        : mPrimes{&xPrimes}, mResidues{xResidues}
+    {
+    }
+
+    [[nodiscard]] constexpr const std::array<std::uint64_t, Count> &getResidues() const noexcept
+    {
+        return mResidues;
+    }
+
+    /**
+     * @brief Returns true if both fingerprints use the same primes and have the same residues.
+     *
+     * Residues modulo different primes are unrelated, e.g. every small integer has the same residues
+     * in every context, so fingerprints of different contexts only compare equal if their primes do.
+     */
+    [[nodiscard]] constexpr bool operator==(const Fingerprint &xIn) const noexcept
+    {
+        return (mPrimes == xIn.mPrimes || *mPrimes == *xIn.mPrimes) && mResidues == xIn.mResidues;
+    }
+
+    constexpr Fingerprint &operator+=(const Fingerprint &xOther) noexcept
+    {
+        for (std::size_t i = 0; i < Count; ++i)
+            mResidues[i] = mod_add(mResidues[i], xOther.mResidues[i], (*mPrimes)[i]);
+        return *this;
+    }
+
+    constexpr Fingerprint &operator-=(const Fingerprint &xOther) noexcept
+    {
+        for (std::size_t i = 0; i < Count; ++i)
+            mResidues[i] = mod_sub(mResidues[i], xOther.mResidues[i], (*mPrimes)[i]);
+        return *this;
+    }
+
+    constexpr Fingerprint &operator*=(const Fingerprint &xOther) noexcept
+    {
+        for (std::size_t i = 0; i < Count; ++i)
+            mResidues[i] = mod_mul(mResidues[i], xOther.mResidues[i], (*mPrimes)[i]);
+        return *this;
+    }
+
+    /**
+     * @brief Divides by another fingerprint.
+     * @exception std::invalid_argument - If the divisor vanishes modulo one of the primes.
+     */
+    constexpr Fingerprint &operator/=(const Fingerprint &xOther) noexcept(false)
+    {
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            if (xOther.mResidues[i] == 0)
+                throw std::invalid_argument("Division by a fingerprint of zero.");
+            mResidues[i] = mod_mul(mResidues[i], mod_inverse(xOther.mResidues[i], (*mPrimes)[i]), (*mPrimes)[i]);
+        }
+        return *this;
+    }
+
+    constexpr friend Fingerprint operator+(Fingerprint lhs, const Fingerprint &rhs) noexcept
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    constexpr friend Fingerprint operator-(Fingerprint lhs, const Fingerprint &rhs) noexcept
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    constexpr friend Fingerprint operator*(Fingerprint lhs, const Fingerprint &rhs) noexcept
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    constexpr friend Fingerprint operator/(Fingerprint lhs, const Fingerprint &rhs) noexcept(false)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    /**
+     * @brief Combines all residues into one hash value, usable to bucket or deduplicate expressions.
+     */
+    [[nodiscard]] constexpr std::size_t hash() const noexcept
+    {
+        std::uint64_t tHash = 0x9E3779B97F4A7C15ull;
+        for (const auto tResidue : mResidues)
+        {
+            tHash ^= tResidue + 0x9E3779B97F4A7C15ull + (tHash << 6) + (tHash >> 2);
+        }
+        return static_cast<std::size_t>(tHash);
+    }
+};
+
+namespace std
+{
+    template <std::size_t Count>
+    struct hash<Fingerprint<Count>>
+    {
+        [[nodiscard]] std::size_t operator()(const Fingerprint<Count> &xIn) const noexcept
+        {
+            return xIn.hash();
+        }
+    };
+}
+
+/**
+ * @brief Draws Count random 61-bit primes and maps fractions into Z/pZ for each of them.
+ *
+ * A fraction n/d maps to n * d^-1 mod p. Two different fractions whose numerators and denominators
+ * have at most B bits can only collide modulo p if p divides the 2B-bit cross difference, which
+ * holds for at most 2B/60 of the roughly 2^55 primes in [2^60, 2^61). With Count independent primes
+ * the false-positive probability per comparison is below (2B / 2^61)^Count, so Count tunes the rate.
+ * After k field operations the bound grows by a factor of about k per prime.
+ *
+ * The context must outlive all fingerprints created from it.
+ *
+ * @tparam Count Number of primes.
+ */
+template <std::size_t Count = 2>
+class FingerprintContext
+{
+    std::array<std::uint64_t, Count> mPrimes{}; ///< Random primes in [2^60, 2^61).
+
+public:
+    /**
+     * @brief Draws the primes from a generator seeded with xSeed.
+     */
+    explicit FingerprintContext(std::uint64_t xSeed = std::random_device{}())
+    {
+        std::mt19937_64 tGen{xSeed};
+        std::uniform_int_distribution<std::uint64_t> tDist{1ull << 60, (1ull << 61) - 1};
+        for (auto &tPrime : mPrimes)
+        {
+            do
+            {
+                tPrime = tDist(tGen) | 1;
+            } while (!is_prime_u64(tPrime));
+        }
+    }
+
+    FingerprintContext(const FingerprintContext &) = delete;
+    FingerprintContext &operator=(const FingerprintContext &) = delete;
+
+    [[nodiscard]] const std::array<std::uint64_t, Count> &getPrimes() const noexcept
+    {
+        return mPrimes;
+    }
+
+    /**
+     * @brief Maps an integer value into the fingerprint domain.
+     */
+    template <typename Type>
+    [[nodiscard]] Fingerprint<Count> fromInteger(const Type &xValue) const
+    {
+        std::array<std::uint64_t, Count> tResidues{};
+        for (std::size_t i = 0; i < Count; ++i)
+            tResidues[i] = to_residue(xValue, mPrimes[i]);
+        return Fingerprint<Count>{mPrimes, tResidues};
+    }
+
+    /**
+     * @brief Maps a fraction into the fingerprint domain.
+     * @exception std::invalid_argument - If the denominator vanishes modulo one of the primes.
+     */
+    template <MathType Type>
+    [[nodiscard]] Fingerprint<Count> operator()(const Fraction<Type> &xValue) const noexcept(false)
+    {
+        std::array<std::uint64_t, Count> tResidues{};
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            const auto tDenominator = to_residue(xValue.getDenominator(), mPrimes[i]);
+            if (tDenominator == 0)
+                throw std::invalid_argument("Denominator vanishes modulo a fingerprint prime.");
+            tResidues[i] = mod_mul(to_residue(xValue.getNumerator(), mPrimes[i]), mod_inverse(tDenominator, mPrimes[i]), mPrimes[i]);
+        }
+        return Fingerprint<Count>{mPrimes, tResidues};
+    }
+};
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Describes how to look at the leading bits of a multi-limb integer type.
+ *
+ * Specialize this for a custom bignum type to make it usable with lehmer_GCD().
+ * A specialization has to provide:
+ *  - static std::size_t bitLength(const T &) -> number of significant bits,
+ *  - static std::uint64_t leadingBits(const T &, std::size_t xShift) -> (x >> xShift) truncated to 64 bits,
+ *  - static T fromWord(std::uint64_t) -> conversion of a single word into T.
+ *
+ * @tparam T The unsigned multi-limb integer type.
+ */
+template <typename T>
+struct WideIntegerTraits;
+
+#ifdef __SIZEOF_INT128__
+template <>
+struct WideIntegerTraits<unsigned __int128>
+{
+    [[nodiscard]] static constexpr std::size_t bitLength(const unsigned __int128 &xValue) noexcept
+    {
+        const auto tHigh = static_cast<std::uint64_t>(xValue >> 64);
+        if (tHigh != 0)
+            return 128 - static_cast<std::size_t>(std::countl_zero(tHigh));
+        return 64 - static_cast<std::size_t>(std::countl_zero(static_cast<std::uint64_t>(xValue)));
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t leadingBits(const unsigned __int128 &xValue, std::size_t xShift) noexcept
+    {
+        return static_cast<std::uint64_t>(xValue >> xShift);
+    }
+
+    [[nodiscard]] static constexpr unsigned __int128 fromWord(std::uint64_t xValue) noexcept
+    {
+        return xValue;
+    }
+};
+#endif
+
+// Concepts for types with a WideIntegerTraits specialization.
+template <typename T>
+concept LehmerCapable = requires(const T &a, std::size_t s, std::uint64_t w) {
+    requires std::is_convertible_v<decltype(WideIntegerTraits<T>::bitLength(a)), std::size_t>;
+    requires std::is_convertible_v<decltype(WideIntegerTraits<T>::leadingBits(a, s)), std::uint64_t>;
+    requires std::is_convertible_v<decltype(WideIntegerTraits<T>::fromWord(w)), T>;
+    { a % a };
+};
+
+/**
+ * @brief Bit length above which fraction_GCD() switches from Euclid to Lehmer for LehmerCapable types.
+ *
+ * Below two words the single precision simulation of Lehmer does not pay off.
+ */
+inline constexpr std::size_t kLehmerThreshold = 64;
+
+/**
+ * @brief Returns the absolute value of xValue without relying on std::abs overloads.
+ */
+template <typename T>
+[[nodiscard]] constexpr T gcd_abs(const T &xValue) noexcept
+{
+    if constexpr (std::is_unsigned_v<T>)
+        return xValue;
+    else
+        return xValue < T(0) ? T(-xValue) : xValue;
+}
+
+/**
+ * @brief Calculates the greatest common divisor with the classic Euclidean algorithm.
+ *
+ * Works for every type that supports the modulo operator, including custom types.
+ * The result is always non-negative and gcd(0, x) == |x|.
+ */
+template <typename T>
+[[nodiscard]] constexpr T euclid_GCD(T a, T b) noexcept
+{
+    a = gcd_abs(a);
+    b = gcd_abs(b);
+    while (b != T(0))
+    {
+        T tRest = a % b;
+        a = std::move(b);
+        b = std::move(tRest);
+    }
+    return a;
+}
+
+/**
+ * @brief Calculates the greatest common divisor with Stein's binary algorithm.
+ *
+ * Only uses shifts and subtractions, which is considerably faster than hardware division
+ * for built-in integer types. The result is non-negative except for gcd(min, 0) and gcd(min, min)
+ * of a signed type: their GCD 2^digits is not representable and wraps to min.
+ */
+template <typename T>
+    requires std::is_integral_v<T>
+[[nodiscard]] constexpr T binary_GCD(const T &a, const T &b) noexcept
+{
+    using Unsigned_t = std::make_unsigned_t<T>;
+
+    // Negation is done in the unsigned domain so that the minimal value does not overflow.
+    auto tA = static_cast<Unsigned_t>(a < 0 ? Unsigned_t(0) - static_cast<Unsigned_t>(a) : static_cast<Unsigned_t>(a));
+    auto tB = static_cast<Unsigned_t>(b < 0 ? Unsigned_t(0) - static_cast<Unsigned_t>(b) : static_cast<Unsigned_t>(b));
+
+    if (tA == 0)
+        return static_cast<T>(tB);
+    if (tB == 0)
+        return static_cast<T>(tA);
+
+    const auto tShift = std::countr_zero(static_cast<Unsigned_t>(tA | tB));
+    tA = static_cast<Unsigned_t>(tA >> std::countr_zero(tA));
+    do
+    {
+        tB = static_cast<Unsigned_t>(tB >> std::countr_zero(tB));
+        if (tA > tB)
+            std::swap(tA, tB);
+        tB = static_cast<Unsigned_t>(tB - tA);
+    } while (tB != 0);
+
+    return static_cast<T>(tA << tShift);
+}
+
+namespace fraction_detail
+{
+    /**
+     * @brief Builds the GCD table for all pairs of values below 256.
+     *
+     * Row a only depends on rows b < a through gcd(a, b) = gcd(b, a mod b), so every entry costs
+     * one lookup and the table stays cheap to evaluate at compile time.
+     */
+    [[nodiscard]] constexpr std::array<std::uint8_t, 256 * 256> make_small_GCD_table() noexcept
+    {
+        std::array<std::uint8_t, 256 * 256> tTable{};
+        for (std::size_t a = 0; a < 256; ++a)
+        {
+            tTable[a * 256] = static_cast<std::uint8_t>(a);
+            tTable[a] = static_cast<std::uint8_t>(a);
+            for (std::size_t b = 1; b <= a; ++b)
+            {
+                const auto tGCD = tTable[b * 256 + a % b];
+                tTable[a * 256 + b] = tGCD;
+                tTable[b * 256 + a] = tGCD;
+            }
+        }
+        return tTable;
+    }
+}
+
+/**
+ * @brief Upper bound (exclusive) of the absolute values covered by kSmallGCDTable.
+ */
+inline constexpr std::uint32_t kSmallGCDLimit = 256;
+
+/**
+ * @brief Packed 256 x 256 table with gcd(a, b) at index a * 256 + b, generated at compile time.
+ */
+inline constexpr auto kSmallGCDTable = fraction_detail::make_small_GCD_table();
+
+/**
+ * @brief Looks up the greatest common divisor of two small values.
+ * @pre |a| < kSmallGCDLimit and |b| < kSmallGCDLimit.
+ */
+template <typename T>
+    requires std::is_integral_v<T>
+[[nodiscard]] constexpr T table_GCD(const T &a, const T &b) noexcept
+{
+    using Unsigned_t = std::make_unsigned_t<T>;
+    const auto tA = static_cast<std::uint32_t>(static_cast<Unsigned_t>(a < 0 ? Unsigned_t(0) - static_cast<Unsigned_t>(a) : static_cast<Unsigned_t>(a)));
+    const auto tB = static_cast<std::uint32_t>(static_cast<Unsigned_t>(b < 0 ? Unsigned_t(0) - static_cast<Unsigned_t>(b) : static_cast<Unsigned_t>(b)));
+    return static_cast<T>(kSmallGCDTable[tA * kSmallGCDLimit + tB]);
+}
+
+/**
+ * @brief Calculates X * x + Y * y for Lehmer cofactors, which never have the same strict sign.
+ *
+ * The result is known to be non-negative, so the computation can be done with unsigned types.
+ * One cofactor may be 0 (e.g. X = 0, Y = 1 after a single step), so the branch follows the sign of Y.
+ */
+template <LehmerCapable T>
+[[nodiscard]] constexpr T lehmer_combine(const T &x, std::int64_t X, const T &y, std::int64_t Y)
+{
+    using Traits = WideIntegerTraits<T>;
+    if (Y <= 0)
+        return Traits::fromWord(static_cast<std::uint64_t>(X)) * x - Traits::fromWord(static_cast<std::uint64_t>(-Y)) * y;
+    return Traits::fromWord(static_cast<std::uint64_t>(Y)) * y - Traits::fromWord(static_cast<std::uint64_t>(-X)) * x;
+}
+
+/**
+ * @brief Calculates the greatest common divisor of two multi-limb unsigned integers with Lehmer's algorithm.
+ *
+ * Runs the Euclidean algorithm on the leading 62 bits of both operands with single-word
+ * arithmetic and only applies the collected cofactor matrix to the full values
+ * (Knuth, TAOCP Vol. 2, Algorithm 4.5.2L). This replaces most multi-limb divisions by a few
+ * multi-limb by single-word multiplications. Once both values fit into one word the
+ * remainder is handled by binary_GCD().
+ *
+ * @param a The first (non-negative) number.
+ * @param b The second (non-negative) number.
+ * @return The GCD of a and b.
+ */
+template <LehmerCapable T>
+[[nodiscard]] constexpr T lehmer_GCD(T a, T b)
+{
+    using Traits = WideIntegerTraits<T>;
+
+    if (a < b)
+        std::swap(a, b);
+
+    while (b != T(0))
+    {
+        const std::size_t tBits = Traits::bitLength(a);
+        if (tBits <= 64)
+        {
+            return Traits::fromWord(binary_GCD(Traits::leadingBits(a, 0), Traits::leadingBits(b, 0)));
+        }
+
+        const std::size_t tShift = tBits - 62;
+        auto tAHat = static_cast<std::int64_t>(Traits::leadingBits(a, tShift));
+        auto tBHat = static_cast<std::int64_t>(Traits::leadingBits(b, tShift));
+        std::int64_t A = 1, B = 0, C = 0, D = 1;
+
+        while (tBHat + C != 0 && tBHat + D != 0)
+        {
+            const std::int64_t q = (tAHat + A) / (tBHat + C);
+            if (q != (tAHat + B) / (tBHat + D))
+                break;
+
+            std::int64_t tTemp = A - q * C;
+            A = C;
+            C = tTemp;
+            tTemp = B - q * D;
+            B = D;
+            D = tTemp;
+            tTemp = tAHat - q * tBHat;
+            tAHat = tBHat;
+            tBHat = tTemp;
+        }
+
+        if (B == 0)
+        {
+            // The leading words did not determine a single quotient, do one full precision step.
+            T tRest = a % b;
+            a = std::move(b);
+            b = std::move(tRest);
+        }
+        else
+        {
+            T tA = lehmer_combine(a, A, b, B);
+            T tB = lehmer_combine(a, C, b, D);
+            a = std::move(tA);
+            b = std::move(tB);
+        }
+    }
+
+    return a;
+}
+
+/**
+ * @brief Calculates the greatest common divisor with the best algorithm available for T.
+ *
+ * - built-in integers use table_GCD() if both values are below kSmallGCDLimit and binary_GCD() otherwise,
+ * - LehmerCapable (multi-limb) types use lehmer_GCD() once they exceed kLehmerThreshold bits,
+ * - every other type falls back to euclid_GCD().
+ *
+ * The result is non-negative; see binary_GCD() for the unrepresentable gcd(min, 0) of signed types.
+ */
+template <typename T>
+[[nodiscard]] constexpr T fraction_GCD(const T &a, const T &b) noexcept
+{
+    if constexpr (std::is_integral_v<T> && sizeof(T) == 1)
+    {
+        return table_GCD(a, b);
+    }
+    else if constexpr (std::is_unsigned_v<T>)
+    {
+        if (a < kSmallGCDLimit && b < kSmallGCDLimit)
+            return table_GCD(a, b);
+        return binary_GCD(a, b);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        using Unsigned_t = std::make_unsigned_t<T>;
+        // Values in (-256, 256) map to unsigned values < 256 or > max - 256 after the cast, so one
+        // add and compare per operand tells whether the table covers both.
+        const auto tA = static_cast<Unsigned_t>(static_cast<Unsigned_t>(a) + (kSmallGCDLimit - 1));
+        const auto tB = static_cast<Unsigned_t>(static_cast<Unsigned_t>(b) + (kSmallGCDLimit - 1));
+        if (tA < 2 * kSmallGCDLimit - 1 && tB < 2 * kSmallGCDLimit - 1)
+            return table_GCD(a, b);
+        return binary_GCD(a, b);
+    }
+#ifdef __SIZEOF_INT128__
+    else if constexpr (std::is_same_v<T, __int128>)
+    {
+        const auto tA = static_cast<unsigned __int128>(gcd_abs(a));
+        const auto tB = static_cast<unsigned __int128>(gcd_abs(b));
+        return static_cast<T>(fraction_GCD(tA, tB));
+    }
+#endif
+    else if constexpr (LehmerCapable<T>)
+    {
+        const auto tA = gcd_abs(a);
+        const auto tB = gcd_abs(b);
+        const auto tLarger = tA < tB ? tB : tA;
+        if (WideIntegerTraits<T>::bitLength(tLarger) > kLehmerThreshold)
+            return lehmer_GCD(tA, tB);
+        return euclid_GCD(tA, tB);
+    }
+    else
+    {
+        return euclid_GCD(a, b);
+    }
+}
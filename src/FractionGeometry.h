@@ -0,0 +1,417 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionColumn.h"
+#include "FractionDivisor.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace fraction_detail
+{
+    /**
+     * @brief Fixed-width signed integer in sign-magnitude form with Limbs 64-bit words.
+     *
+     * Only what exact determinant signs need: construction from built-in integers, +, -, * and sign().
+     * The width is chosen by the caller so that no intermediate overflows.
+     */
+    template <std::size_t Limbs>
+    class ExactInt
+    {
+        std::array<std::uint64_t, Limbs> mMagnitude{}; ///< Little-endian magnitude.
+        bool mNegative{false};                         ///< Sign, false for zero.
+
+        [[nodiscard]] static constexpr int compareMagnitude(const ExactInt &a, const ExactInt &b) noexcept
+        {
+            for (std::size_t i = Limbs; i-- > 0;)
+            {
+                if (a.mMagnitude[i] != b.mMagnitude[i])
+                    return a.mMagnitude[i] < b.mMagnitude[i] ? -1 : 1;
+            }
+            return 0;
+        }
+
+        [[nodiscard]] static constexpr ExactInt addMagnitude(const ExactInt &a, const ExactInt &b, bool xNegative) noexcept
+        {
+            ExactInt tResult;
+            std::uint64_t tCarry = 0;
+            for (std::size_t i = 0; i < Limbs; ++i)
+            {
+                const std::uint64_t tSum = a.mMagnitude[i] + tCarry;
+                const std::uint64_t tCarry1 = tSum < tCarry ? 1 : 0;
+                tResult.mMagnitude[i] = tSum + b.mMagnitude[i];
+                tCarry = tCarry1 + (tResult.mMagnitude[i] < tSum ? 1 : 0);
+            }
+            tResult.mNegative = xNegative && !tResult.isZero();
+            return tResult;
+        }
+
+        /// Requires |a| >= |b|.
+        [[nodiscard]] static constexpr ExactInt subMagnitude(const ExactInt &a, const ExactInt &b, bool xNegative) noexcept
+        {
+            ExactInt tResult;
+            std::uint64_t tBorrow = 0;
+            for (std::size_t i = 0; i < Limbs; ++i)
+            {
+                const std::uint64_t tDiff = a.mMagnitude[i] - b.mMagnitude[i];
+                const std::uint64_t tBorrow1 = a.mMagnitude[i] < b.mMagnitude[i] ? 1 : 0;
+                tResult.mMagnitude[i] = tDiff - tBorrow;
+                tBorrow = tBorrow1 + (tDiff < tBorrow ? 1 : 0);
+            }
+            tResult.mNegative = xNegative && !tResult.isZero();
+            return tResult;
+        }
+
+    public:
+        constexpr ExactInt() noexcept = default;
+
+        template <typename T>
+            requires std::is_integral_v<T>
+        constexpr ExactInt(T xValue) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                mNegative = xValue < 0;
+                using Unsigned_t = std::make_unsigned_t<T>;
+                const auto tMagnitude = mNegative ? static_cast<Unsigned_t>(Unsigned_t(0) - static_cast<Unsigned_t>(xValue)) : static_cast<Unsigned_t>(xValue);
+                mMagnitude[0] = static_cast<std::uint64_t>(tMagnitude);
+            }
+            else
+            {
+                mMagnitude[0] = static_cast<std::uint64_t>(xValue);
+            }
+        }
+
+        [[nodiscard]] constexpr bool isZero() const noexcept
+        {
+            for (const auto tLimb : mMagnitude)
+            {
+                if (tLimb != 0)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Returns -1, 0 or 1.
+         */
+        [[nodiscard]] constexpr int sign() const noexcept
+        {
+            return isZero() ? 0 : (mNegative ? -1 : 1);
+        }
+
+        constexpr friend ExactInt operator-(ExactInt xValue) noexcept
+        {
+            xValue.mNegative = !xValue.mNegative && !xValue.isZero();
+            return xValue;
+        }
+
+        constexpr friend ExactInt operator+(const ExactInt &a, const ExactInt &b) noexcept
+        {
+            if (a.mNegative == b.mNegative)
+                return addMagnitude(a, b, a.mNegative);
+            if (compareMagnitude(a, b) >= 0)
+                return subMagnitude(a, b, a.mNegative);
+            return subMagnitude(b, a, b.mNegative);
+        }
+
+        constexpr friend ExactInt operator-(const ExactInt &a, const ExactInt &b) noexcept
+        {
+            return a + (-b);
+        }
+
+        constexpr friend ExactInt operator*(const ExactInt &a, const ExactInt &b) noexcept
+        {
+            ExactInt tResult;
+            for (std::size_t i = 0; i < Limbs; ++i)
+            {
+                if (a.mMagnitude[i] == 0)
+                    continue;
+                std::uint64_t tCarry = 0;
+                for (std::size_t j = 0; i + j < Limbs; ++j)
+                {
+                    // (high, low) = a_i * b_j + result_(i+j) + carry never overflows 128 bits.
+                    const std::uint64_t tLow = a.mMagnitude[i] * b.mMagnitude[j];
+                    std::uint64_t tHigh = mul_high(a.mMagnitude[i], b.mMagnitude[j]);
+                    std::uint64_t tSum = tLow + tResult.mMagnitude[i + j];
+                    tHigh += tSum < tLow ? 1 : 0;
+                    const std::uint64_t tSum2 = tSum + tCarry;
+                    tHigh += tSum2 < tSum ? 1 : 0;
+                    tResult.mMagnitude[i + j] = tSum2;
+                    tCarry = tHigh;
+                }
+            }
+            tResult.mNegative = (a.mNegative != b.mNegative) && !tResult.isZero();
+            return tResult;
+        }
+    };
+
+    template <typename Type, std::size_t Degree>
+    struct ExactDeterminant
+    {
+        using type = Type;
+    };
+
+    template <typename Type, std::size_t Degree>
+        requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::uint64_t))
+    struct ExactDeterminant<Type, Degree>
+    {
+        // Degree factors of Type plus one spare limb for the sums of the expansion.
+        using type = ExactInt<(Degree * 8 * sizeof(Type) + 63) / 64 + 1>;
+    };
+
+    /**
+     * @brief Integer type that holds any product of Degree Type values plus a few sums exactly.
+     */
+    template <typename Type, std::size_t Degree>
+    using ExactDeterminant_t = typename ExactDeterminant<Type, Degree>::type;
+
+    template <typename Int>
+    [[nodiscard]] constexpr int sign_of(const Int &xValue) noexcept
+    {
+        if constexpr (requires { xValue.sign(); })
+            return xValue.sign();
+        else
+            return (Int(0) < xValue) - (xValue < Int(0));
+    }
+
+    template <typename Int>
+    [[nodiscard]] constexpr Int det3(const std::array<std::array<Int, 3>, 3> &m) noexcept
+    {
+        return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+               m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    }
+
+    template <typename Int>
+    [[nodiscard]] constexpr Int det4(const std::array<std::array<Int, 4>, 4> &m) noexcept
+    {
+        // Laplace expansion along the first row over 2x2 minors of the lower rows.
+        const Int s0 = m[2][0] * m[3][1] - m[2][1] * m[3][0];
+        const Int s1 = m[2][0] * m[3][2] - m[2][2] * m[3][0];
+        const Int s2 = m[2][0] * m[3][3] - m[2][3] * m[3][0];
+        const Int s3 = m[2][1] * m[3][2] - m[2][2] * m[3][1];
+        const Int s4 = m[2][1] * m[3][3] - m[2][3] * m[3][1];
+        const Int s5 = m[2][2] * m[3][3] - m[2][3] * m[3][2];
+
+        const Int c0 = m[1][1] * s5 - m[1][2] * s4 + m[1][3] * s3;
+        const Int c1 = m[1][0] * s5 - m[1][2] * s2 + m[1][3] * s1;
+        const Int c2 = m[1][0] * s4 - m[1][1] * s2 + m[1][3] * s0;
+        const Int c3 = m[1][0] * s3 - m[1][1] * s1 + m[1][2] * s0;
+        return m[0][0] * c0 - m[0][1] * c1 + m[0][2] * c2 - m[0][3] * c3;
+    }
+
+    /**
+     * @brief Returns numerator and denominator of xValue in Int with a positive denominator.
+     */
+    template <typename Int, MathType Type>
+    [[nodiscard]] constexpr std::array<Int, 2> signed_parts(const Fraction<Type> &xValue) noexcept
+    {
+        if constexpr (!std::is_unsigned_v<Type>)
+        {
+            if (xValue.getDenominator() < Type(0))
+                return {-Int(xValue.getNumerator()), -Int(xValue.getDenominator())};
+        }
+        return {Int(xValue.getNumerator()), Int(xValue.getDenominator())};
+    }
+}
+
+/**
+ * @brief Point in the plane with fraction coordinates.
+ */
+template <MathType Type>
+struct FractionPoint2
+{
+    Fraction<Type> x;
+    Fraction<Type> y;
+};
+
+/**
+ * @brief Point in space with fraction coordinates.
+ */
+template <MathType Type>
+struct FractionPoint3
+{
+    Fraction<Type> x;
+    Fraction<Type> y;
+    Fraction<Type> z;
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Homogeneous integer coordinates (X, Y, W) with x = X / W, y = Y / W and W > 0.
+     */
+    template <typename Int, MathType Type>
+    [[nodiscard]] constexpr std::array<Int, 3> homogeneous(const FractionPoint2<Type> &xPoint) noexcept
+    {
+        const auto [xn, xd] = signed_parts<Int>(xPoint.x);
+        const auto [yn, yd] = signed_parts<Int>(xPoint.y);
+        return {xn * yd, yn * xd, xd * yd};
+    }
+
+    template <typename Int, MathType Type>
+    [[nodiscard]] constexpr std::array<Int, 4> homogeneous(const FractionPoint3<Type> &xPoint) noexcept
+    {
+        const auto [xn, xd] = signed_parts<Int>(xPoint.x);
+        const auto [yn, yd] = signed_parts<Int>(xPoint.y);
+        const auto [zn, zd] = signed_parts<Int>(xPoint.z);
+        return {xn * yd * zd, yn * xd * zd, zn * xd * yd, xd * yd * zd};
+    }
+
+    /**
+     * @brief Exact comparison of two fractions.
+     */
+    template <MathType Type>
+    [[nodiscard]] constexpr int compare(const Fraction<Type> &a, const Fraction<Type> &b) noexcept
+    {
+        return cross_compare(a.getNumerator(), a.getDenominator(), b.getNumerator(), b.getDenominator());
+    }
+}
+
+/**
+ * @brief Exact orientation of the triangle (a, b, c).
+ *
+ * Every point is mapped to homogeneous integer coordinates with a positive weight, so the sign of one
+ * 3x3 integer determinant decides the predicate; no fraction is ever normalized.
+ *
+ * @return 1 for a counter-clockwise turn, -1 for a clockwise turn and 0 if the points are collinear.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr int orientation(const FractionPoint2<Type> &a, const FractionPoint2<Type> &b, const FractionPoint2<Type> &c) noexcept
+{
+    using Int = fraction_detail::ExactDeterminant_t<Type, 6>;
+    return fraction_detail::sign_of(
+        fraction_detail::det3<Int>({fraction_detail::homogeneous<Int>(a), fraction_detail::homogeneous<Int>(b), fraction_detail::homogeneous<Int>(c)}));
+}
+
+/**
+ * @brief Exact orientation of the tetrahedron (a, b, c, d).
+ * @return 1 if d lies on the positive side of the plane through a, b, c (counter-clockwise seen from d), -1 for the other side, 0 if coplanar.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr int orientation(const FractionPoint3<Type> &a, const FractionPoint3<Type> &b, const FractionPoint3<Type> &c,
+                                        const FractionPoint3<Type> &d) noexcept
+{
+    using Int = fraction_detail::ExactDeterminant_t<Type, 12>;
+    // det[a 1; b 1; c 1; d 1] with homogeneous rows equals the affine determinant times W_a W_b W_c W_d > 0.
+    return -fraction_detail::sign_of(fraction_detail::det4<Int>({fraction_detail::homogeneous<Int>(a), fraction_detail::homogeneous<Int>(b),
+                                                                 fraction_detail::homogeneous<Int>(c), fraction_detail::homogeneous<Int>(d)}));
+}
+
+/**
+ * @brief Exact in-circle test.
+ * @return 1 if d lies inside the circle through the counter-clockwise triangle (a, b, c), -1 outside, 0 on the circle.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr int in_circle(const FractionPoint2<Type> &a, const FractionPoint2<Type> &b, const FractionPoint2<Type> &c,
+                                      const FractionPoint2<Type> &d) noexcept
+{
+    using Int = fraction_detail::ExactDeterminant_t<Type, 16>;
+    const auto tRow = [](const FractionPoint2<Type> &xPoint)
+    {
+        const auto [X, Y, W] = fraction_detail::homogeneous<Int>(xPoint);
+        // Row (x, y, x^2 + y^2, 1) scaled by W^2 > 0.
+        return std::array<Int, 4>{X * W, Y * W, X * X + Y * Y, W * W};
+    };
+    return fraction_detail::sign_of(fraction_detail::det4<Int>({tRow(a), tRow(b), tRow(c), tRow(d)}));
+}
+
+/**
+ * @brief Exact test whether the closed segments [p1, p2] and [q1, q2] share at least one point.
+ */
+template <MathType Type>
+[[nodiscard]] constexpr bool segments_intersect(const FractionPoint2<Type> &p1, const FractionPoint2<Type> &p2, const FractionPoint2<Type> &q1,
+                                                const FractionPoint2<Type> &q2) noexcept
+{
+    const auto tOnSegment = [](const FractionPoint2<Type> &a, const FractionPoint2<Type> &b, const FractionPoint2<Type> &c)
+    {
+        using fraction_detail::compare;
+        const bool tX = (compare(c.x, a.x) >= 0 && compare(c.x, b.x) <= 0) || (compare(c.x, b.x) >= 0 && compare(c.x, a.x) <= 0);
+        const bool tY = (compare(c.y, a.y) >= 0 && compare(c.y, b.y) <= 0) || (compare(c.y, b.y) >= 0 && compare(c.y, a.y) <= 0);
+        return tX && tY;
+    };
+
+    const int o1 = orientation(p1, p2, q1);
+    const int o2 = orientation(p1, p2, q2);
+    const int o3 = orientation(q1, q2, p1);
+    const int o4 = orientation(q1, q2, p2);
+
+    if (o1 * o2 < 0 && o3 * o4 < 0)
+        return true;
+    return (o1 == 0 && tOnSegment(p1, p2, q1)) || (o2 == 0 && tOnSegment(p1, p2, q2)) || (o3 == 0 && tOnSegment(q1, q2, p1)) ||
+           (o4 == 0 && tOnSegment(q1, q2, p2));
+}
+
+/**
+ * @brief Calculates the orientation of (a, b, c) for many points c at once.
+ *
+ * The 2x2 minors of a and b are computed once, so every point costs three products and two sums in
+ * the exact integer type. The loop has no dependencies between iterations.
+ *
+ * @param xOut Receives 1, -1 or 0 per point, see orientation().
+ * @exception std::invalid_argument - If xPoints and xOut have different sizes.
+ */
+template <MathType Type>
+void orientation_batch(const FractionPoint2<Type> &a, const FractionPoint2<Type> &b, std::span<const FractionPoint2<Type>> xPoints,
+                       std::span<int> xOut) noexcept(false)
+{
+    if (xPoints.size() != xOut.size())
+        throw std::invalid_argument("Points and output must have the same size.");
+
+    using Int = fraction_detail::ExactDeterminant_t<Type, 6>;
+    const auto [Xa, Ya, Wa] = fraction_detail::homogeneous<Int>(a);
+    const auto [Xb, Yb, Wb] = fraction_detail::homogeneous<Int>(b);
+    const Int tMinorX = Ya * Wb - Wa * Yb;
+    const Int tMinorY = Xa * Wb - Wa * Xb;
+    const Int tMinorW = Xa * Yb - Ya * Xb;
+
+    for (std::size_t i = 0; i < xPoints.size(); ++i)
+    {
+        const auto [Xc, Yc, Wc] = fraction_detail::homogeneous<Int>(xPoints[i]);
+        xOut[i] = fraction_detail::sign_of(Xc * tMinorX - Yc * tMinorY + Wc * tMinorW);
+    }
+}
+
+/**
+ * @brief Calculates the convex hull with Andrew's monotone chain and exact predicates.
+ * @return The hull vertices in counter-clockwise order starting at the lexicographically smallest point, without collinear points.
+ */
+template <MathType Type>
+[[nodiscard]] std::vector<FractionPoint2<Type>> convex_hull(std::span<const FractionPoint2<Type>> xPoints)
+{
+    std::vector<FractionPoint2<Type>> tPoints(xPoints.begin(), xPoints.end());
+    const auto tLess = [](const FractionPoint2<Type> &a, const FractionPoint2<Type> &b)
+    {
+        const int tX = fraction_detail::compare(a.x, b.x);
+        return tX < 0 || (tX == 0 && fraction_detail::compare(a.y, b.y) < 0);
+    };
+    const auto tEqual = [](const FractionPoint2<Type> &a, const FractionPoint2<Type> &b)
+    { return fraction_detail::compare(a.x, b.x) == 0 && fraction_detail::compare(a.y, b.y) == 0; };
+
+    std::sort(tPoints.begin(), tPoints.end(), tLess);
+    tPoints.erase(std::unique(tPoints.begin(), tPoints.end(), tEqual), tPoints.end());
+    if (tPoints.size() < 3)
+        return tPoints;
+
+    std::vector<FractionPoint2<Type>> tHull;
+    tHull.reserve(2 * tPoints.size());
+    for (int tPass = 0; tPass < 2; ++tPass)
+    {
+        const std::size_t tStart = tHull.size();
+        for (const auto &tPoint : tPoints)
+        {
+            while (tHull.size() >= tStart + 2 && orientation(tHull[tHull.size() - 2], tHull.back(), tPoint) <= 0)
+                tHull.pop_back();
+            tHull.push_back(tPoint);
+        }
+        tHull.pop_back();
+        std::reverse(tPoints.begin(), tPoints.end());
+    }
+    return tHull;
+}
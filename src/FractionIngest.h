@@ -0,0 +1,254 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionAlgorithm.h"
+#include "FractionColumn.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Parses "n", "n/d" or "n / d" with optional surrounding blanks, without allocating.
+ *
+ * @param xFirst Begin of the text.
+ * @param xLast End of the text.
+ * @param xNumerator Receives the numerator.
+ * @param xDenominator Receives the denominator, 1 if the text is a plain integer.
+ * @return ptr points behind the parsed text and trailing blanks. ec is std::errc::invalid_argument
+ * for malformed text or a zero denominator and std::errc::result_out_of_range if a part does not fit into Type.
+ */
+template <typename Type>
+    requires std::is_integral_v<Type>
+[[nodiscard]] constexpr std::from_chars_result parse_fraction(const char *xFirst, const char *xLast, Type &xNumerator, Type &xDenominator) noexcept
+{
+    const auto tSkipBlanks = [xLast](const char *p)
+    {
+        while (p != xLast && (*p == ' ' || *p == '\t' || *p == '\r'))
+            ++p;
+        return p;
+    };
+    const auto tParse = [xLast](const char *p, Type &xValue)
+    {
+        // from_chars rejects a leading '+'.
+        if (p != xLast && *p == '+')
+            ++p;
+        return std::from_chars(p, xLast, xValue);
+    };
+
+    auto tResult = tParse(tSkipBlanks(xFirst), xNumerator);
+    if (tResult.ec != std::errc{})
+        return tResult;
+
+    const char *p = tSkipBlanks(tResult.ptr);
+    if (p == xLast || *p != '/')
+    {
+        xDenominator = Type(1);
+        return {p, std::errc{}};
+    }
+
+    tResult = tParse(tSkipBlanks(p + 1), xDenominator);
+    if (tResult.ec != std::errc{})
+        return tResult;
+    if (xDenominator == Type(0))
+        return {tResult.ptr, std::errc::invalid_argument};
+    return {tSkipBlanks(tResult.ptr), std::errc{}};
+}
+
+/**
+ * @brief Options of the CSV ingestion functions.
+ */
+struct FractionIngestOptions
+{
+    /// Field separator.
+    char delimiter = ',';
+    /// Zero-based index of the field holding the fraction.
+    std::size_t field = 0;
+    /// Skip the first line.
+    bool header = false;
+    /// Thread count and the input size in bytes below which the text is parsed sequentially.
+    FractionParallelOptions parallel{0, 1 << 20};
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Calls xTask(begin, end) for every non-blank line in [xFirst, xLast), without the line break.
+     */
+    template <typename Task>
+    void for_each_line(const char *xFirst, const char *xLast, Task &&xTask)
+    {
+        while (xFirst != xLast)
+        {
+            const auto *tBreak = static_cast<const char *>(std::memchr(xFirst, '\n', static_cast<std::size_t>(xLast - xFirst)));
+            const char *tEnd = tBreak == nullptr ? xLast : tBreak;
+            if (std::any_of(xFirst, tEnd, [](char c) { return c != ' ' && c != '\t' && c != '\r'; }))
+                xTask(xFirst, tEnd);
+            xFirst = tBreak == nullptr ? xLast : tBreak + 1;
+        }
+    }
+
+    /**
+     * @brief Returns the field xIndex of the line [xFirst, xLast), or nullptr as begin if the line has fewer fields.
+     */
+    [[nodiscard]] inline std::pair<const char *, const char *> find_field(const char *xFirst, const char *xLast, char xDelimiter, std::size_t xIndex) noexcept
+    {
+        for (; xIndex > 0; --xIndex)
+        {
+            const auto *tDelimiter = static_cast<const char *>(std::memchr(xFirst, xDelimiter, static_cast<std::size_t>(xLast - xFirst)));
+            if (tDelimiter == nullptr)
+                return {nullptr, nullptr};
+            xFirst = tDelimiter + 1;
+        }
+        const auto *tDelimiter = static_cast<const char *>(std::memchr(xFirst, xDelimiter, static_cast<std::size_t>(xLast - xFirst)));
+        return {xFirst, tDelimiter == nullptr ? xLast : tDelimiter};
+    }
+}
+
+/**
+ * @brief Parses one fraction per line of delimited text into a FractionColumn.
+ *
+ * The text is cut into one chunk per thread at line boundaries. A first parallel pass counts the
+ * rows of every chunk, so both output arrays are allocated once and every chunk parses straight
+ * into its own slice in the second pass; no row is copied and no string is allocated. Blank lines
+ * are skipped.
+ *
+ * @exception std::invalid_argument - If a line has no such field or the field is not a valid fraction.
+ * The message contains the row number, counted without blank lines.
+ * @exception std::out_of_range - If a value does not fit into Type.
+ */
+template <typename Type>
+    requires std::is_integral_v<Type>
+[[nodiscard]] FractionColumn<Type> ingest_fraction_column(std::string_view xText, const FractionIngestOptions &xOptions = {}) noexcept(false)
+{
+    const char *tBegin = xText.data();
+    const char *tEnd = tBegin + xText.size();
+    if (xOptions.header)
+    {
+        const auto *tBreak = static_cast<const char *>(std::memchr(tBegin, '\n', xText.size()));
+        tBegin = tBreak == nullptr ? tEnd : tBreak + 1;
+    }
+
+    // Chunk boundaries, each moved forward behind the next line break.
+    const std::size_t tBlocks = fraction_detail::block_count(static_cast<std::size_t>(tEnd - tBegin), xOptions.parallel);
+    std::vector<const char *> tBounds(tBlocks + 1, tEnd);
+    tBounds[0] = tBegin;
+    for (std::size_t b = 1; b < tBlocks; ++b)
+    {
+        const char *p = std::max(tBounds[b - 1], tBegin + static_cast<std::ptrdiff_t>(b * static_cast<std::size_t>(tEnd - tBegin) / tBlocks));
+        const auto *tBreak = static_cast<const char *>(std::memchr(p, '\n', static_cast<std::size_t>(tEnd - p)));
+        tBounds[b] = tBreak == nullptr ? tEnd : tBreak + 1;
+    }
+
+    std::vector<std::size_t> tOffsets(tBlocks + 1, 0);
+    fraction_detail::for_each_block(tBlocks,
+                                    [&](std::size_t b)
+                                    {
+                                        std::size_t tRows = 0;
+                                        fraction_detail::for_each_line(tBounds[b], tBounds[b + 1], [&tRows](const char *, const char *) { ++tRows; });
+                                        tOffsets[b + 1] = tRows;
+                                    });
+    for (std::size_t b = 0; b < tBlocks; ++b)
+        tOffsets[b + 1] += tOffsets[b];
+
+    std::vector<Type> tNumerators(tOffsets.back());
+    std::vector<Type> tDenominators(tOffsets.back());
+    fraction_detail::for_each_block(
+        tBlocks,
+        [&](std::size_t b)
+        {
+            std::size_t tRow = tOffsets[b];
+            fraction_detail::for_each_line(tBounds[b], tBounds[b + 1],
+                                           [&](const char *xLine, const char *xLineEnd)
+                                           {
+                                               const auto [tField, tFieldEnd] = fraction_detail::find_field(xLine, xLineEnd, xOptions.delimiter, xOptions.field);
+                                               std::from_chars_result tResult{tField, std::errc::invalid_argument};
+                                               if (tField != nullptr)
+                                                   tResult = parse_fraction(tField, tFieldEnd, tNumerators[tRow], tDenominators[tRow]);
+                                               if (tResult.ec == std::errc::result_out_of_range)
+                                                   throw std::out_of_range("Fraction in row " + std::to_string(tRow) + " does not fit into the value type.");
+                                               if (tResult.ec != std::errc{} || tResult.ptr != tFieldEnd)
+                                                   throw std::invalid_argument("Invalid fraction in row " + std::to_string(tRow) + ".");
+                                               ++tRow;
+                                           });
+        });
+
+    return FractionColumn<Type>{std::move(tNumerators), std::move(tDenominators)};
+}
+
+/**
+ * @brief Parses a delimited text file with ingest_fraction_column().
+ *
+ * The file is memory-mapped on POSIX systems, so the parser threads read the page cache directly
+ * and nothing is copied; other systems read it into one buffer.
+ *
+ * @exception std::system_error - If the file cannot be opened or mapped.
+ */
+template <typename Type>
+    requires std::is_integral_v<Type>
+[[nodiscard]] FractionColumn<Type> ingest_fraction_file(const std::filesystem::path &xPath, const FractionIngestOptions &xOptions = {}) noexcept(false)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const int tFile = ::open(xPath.c_str(), O_RDONLY);
+    if (tFile < 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + xPath.string());
+
+    struct stat tStat{};
+    if (::fstat(tFile, &tStat) != 0)
+    {
+        const int tError = errno;
+        ::close(tFile);
+        throw std::system_error(tError, std::generic_category(), "Cannot stat " + xPath.string());
+    }
+    const auto tSize = static_cast<std::size_t>(tStat.st_size);
+    if (tSize == 0)
+    {
+        ::close(tFile);
+        return {};
+    }
+
+    void *tData = ::mmap(nullptr, tSize, PROT_READ, MAP_PRIVATE, tFile, 0);
+    const int tError = errno;
+    ::close(tFile);
+    if (tData == MAP_FAILED)
+        throw std::system_error(tError, std::generic_category(), "Cannot map " + xPath.string());
+#if defined(MADV_SEQUENTIAL)
+    ::madvise(tData, tSize, MADV_SEQUENTIAL);
+#endif
+
+    struct Unmap
+    {
+        void *data;
+        std::size_t size;
+        ~Unmap()
+        {
+            ::munmap(data, size);
+        }
+    } tUnmap{tData, tSize};
+    return ingest_fraction_column<Type>(std::string_view{static_cast<const char *>(tData), tSize}, xOptions);
+#else
+    std::ifstream tStream{xPath, std::ios::binary};
+    if (!tStream)
+        throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), "Cannot open " + xPath.string());
+    const std::string tText{std::istreambuf_iterator<char>{tStream}, std::istreambuf_iterator<char>{}};
+    return ingest_fraction_column<Type>(tText, xOptions);
+#endif
+}
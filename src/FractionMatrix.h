@@ -0,0 +1,698 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionChecked.h"
+#include "FractionModular.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Dense row-major matrix of fractions.
+ */
+template <MathType Type>
+class FractionMatrix
+{
+    std::size_t mRows{0};                ///< Number of rows.
+    std::size_t mCols{0};                ///< Number of columns.
+    std::vector<Fraction<Type>> mData{}; ///< Entries in row-major order.
+
+public:
+    /**
+     * @brief Constructs a xRows x xCols matrix filled with 0/1.
+     */
+    FractionMatrix(std::size_t xRows, std::size_t xCols)
+        : mRows{xRows}, mCols{xCols}, mData(xRows * xCols, Fraction<Type>{Type(0), Type(1)})
+    {
+    }
+
+    /**
+     * @brief Constructs a matrix from nested initializer lists, one list per row.
+     * @exception std::invalid_argument - If the rows have different lengths.
+     */
+    FractionMatrix(std::initializer_list<std::initializer_list<Fraction<Type>>> xRows) noexcept(false)
+        : mRows{xRows.size()}, mCols{xRows.size() == 0 ? 0 : xRows.begin()->size()}
+    {
+        mData.reserve(mRows * mCols);
+        for (const auto &tRow : xRows)
+        {
+            if (tRow.size() != mCols)
+                throw std::invalid_argument("All rows must have the same length.");
+            mData.insert(mData.end(), tRow.begin(), tRow.end());
+        }
+    }
+
+    [[nodiscard]] std::size_t rows() const noexcept
+    {
+        return mRows;
+    }
+
+    [[nodiscard]] std::size_t cols() const noexcept
+    {
+        return mCols;
+    }
+
+    [[nodiscard]] const Fraction<Type> &operator()(std::size_t xRow, std::size_t xCol) const noexcept
+    {
+        return mData[xRow * mCols + xCol];
+    }
+
+    [[nodiscard]] Fraction<Type> &operator()(std::size_t xRow, std::size_t xCol) noexcept
+    {
+        return mData[xRow * mCols + xCol];
+    }
+
+    /**
+     * @brief Returns a view of one row.
+     */
+    [[nodiscard]] std::span<const Fraction<Type>> row(std::size_t xRow) const noexcept
+    {
+        return {mData.data() + xRow * mCols, mCols};
+    }
+};
+
+/**
+ * @brief Options for the multi-modular determinant and solver.
+ */
+struct MultiModularOptions
+{
+    /// Stop as soon as one additional batch of primes does not change the reconstruction.
+    /// The probability of a wrong result is about 2^-62 per accepted batch.
+    bool earlyTermination = true;
+    /// Number of primes processed in parallel, 0 selects std::thread::hardware_concurrency().
+    std::size_t threads = 0;
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Integer matrix obtained by scaling each row of a rational system with the LCM of its denominators.
+     */
+    template <typename Type>
+    struct ClearedSystem
+    {
+        std::size_t rows{0};
+        std::size_t cols{0};
+        std::vector<Type> data{};   ///< Row-major integer entries, including an optional right-hand side column.
+        std::vector<Type> scales{}; ///< LCM of the denominators of every row.
+    };
+
+    /**
+     * @brief Returns the product of all row scales, the denominator of the determinant.
+     * @exception std::overflow_error - If the product overflows a built-in Type.
+     */
+    template <typename Type>
+    [[nodiscard]] Type scale_product(const ClearedSystem<Type> &xSystem) noexcept(false)
+    {
+        Type tProduct{1};
+        for (const auto &tScale : xSystem.scales)
+            tProduct = checked_mul(tProduct, tScale);
+        return tProduct;
+    }
+
+    /**
+     * @brief Multiplies every row of [A | b] by the LCM of the row's denominators.
+     * @exception std::overflow_error - If a scale or a scaled entry overflows a built-in Type.
+     */
+    template <MathType Type>
+    [[nodiscard]] ClearedSystem<Type> clear_denominators(const FractionMatrix<Type> &xMatrix, std::span<const Fraction<Type>> xRhs) noexcept(false)
+    {
+        ClearedSystem<Type> tResult;
+        tResult.rows = xMatrix.rows();
+        tResult.cols = xMatrix.cols() + (xRhs.empty() ? 0 : 1);
+        tResult.data.reserve(tResult.rows * tResult.cols);
+        tResult.scales.reserve(tResult.rows);
+
+        for (std::size_t r = 0; r < xMatrix.rows(); ++r)
+        {
+            Type tScale{1};
+            const auto tAccumulate = [&tScale](const Fraction<Type> &xEntry)
+            {
+                const auto tDen = gcd_abs(xEntry.getDenominator());
+                tScale = checked_mul(tScale / fraction_GCD(tScale, tDen), tDen);
+            };
+            for (const auto &tEntry : xMatrix.row(r))
+                tAccumulate(tEntry);
+            if (!xRhs.empty())
+                tAccumulate(xRhs[r]);
+
+            const auto tPush = [&tResult, &tScale](const Fraction<Type> &xEntry)
+            { tResult.data.push_back(checked_mul(xEntry.getNumerator(), tScale / xEntry.getDenominator())); };
+            for (const auto &tEntry : xMatrix.row(r))
+                tPush(tEntry);
+            if (!xRhs.empty())
+                tPush(xRhs[r]);
+
+            tResult.scales.push_back(tScale);
+        }
+        return tResult;
+    }
+
+    /**
+     * @brief Returns log2 of Hadamard's bound over all rows of the integer system.
+     *
+     * With a right-hand side column included, this also bounds every Cramer determinant.
+     */
+    template <typename Type>
+    [[nodiscard]] double hadamard_bound_bits(const ClearedSystem<Type> &xSystem)
+    {
+        double tBits = 0;
+        for (std::size_t r = 0; r < xSystem.rows; ++r)
+        {
+            long double tNorm = 0;
+            for (std::size_t c = 0; c < xSystem.cols; ++c)
+            {
+                const auto tEntry = static_cast<long double>(xSystem.data[r * xSystem.cols + c]);
+                tNorm += tEntry * tEntry;
+            }
+            if (tNorm > 0)
+                tBits += 0.5 * std::log2(static_cast<double>(tNorm));
+        }
+        return tBits;
+    }
+
+    /**
+     * @brief Gaussian elimination of [B | b] modulo xPrime.
+     *
+     * @param xSystem The system, reduced in place; cols is n for a plain determinant or n + 1 with a right-hand side.
+     * @param xSolution Receives the solution modulo xPrime if the system has a right-hand side and is regular.
+     * @return The determinant of the leading n x n block modulo xPrime.
+     */
+    [[nodiscard]] inline std::uint64_t eliminate_mod_p(std::vector<std::uint64_t> &xSystem, std::size_t n, std::size_t xCols, std::uint64_t xPrime,
+                                                       std::vector<std::uint64_t> *xSolution = nullptr)
+    {
+        std::uint64_t tDet = 1;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::size_t tPivot = k;
+            while (tPivot < n && xSystem[tPivot * xCols + k] == 0)
+                ++tPivot;
+            if (tPivot == n)
+                return 0;
+            if (tPivot != k)
+            {
+                std::swap_ranges(xSystem.begin() + static_cast<std::ptrdiff_t>(tPivot * xCols),
+                                 xSystem.begin() + static_cast<std::ptrdiff_t>((tPivot + 1) * xCols),
+                                 xSystem.begin() + static_cast<std::ptrdiff_t>(k * xCols));
+                tDet = xPrime - tDet;
+            }
+
+            const auto tPivotValue = xSystem[k * xCols + k];
+            tDet = mod_mul(tDet, tPivotValue, xPrime);
+            const auto tInverse = mod_inverse(tPivotValue, xPrime);
+
+            for (std::size_t r = k + 1; r < n; ++r)
+            {
+                const auto tFactor = mod_mul(xSystem[r * xCols + k], tInverse, xPrime);
+                if (tFactor == 0)
+                    continue;
+                for (std::size_t c = k; c < xCols; ++c)
+                    xSystem[r * xCols + c] = mod_sub(xSystem[r * xCols + c], mod_mul(tFactor, xSystem[k * xCols + c], xPrime), xPrime);
+            }
+        }
+
+        if (xSolution != nullptr && xCols == n + 1)
+        {
+            xSolution->assign(n, 0);
+            for (std::size_t i = n; i-- > 0;)
+            {
+                auto tSum = xSystem[i * xCols + n];
+                for (std::size_t c = i + 1; c < n; ++c)
+                    tSum = mod_sub(tSum, mod_mul(xSystem[i * xCols + c], (*xSolution)[c], xPrime), xPrime);
+                (*xSolution)[i] = mod_mul(tSum, mod_inverse(xSystem[i * xCols + i], xPrime), xPrime);
+            }
+        }
+        return tDet;
+    }
+
+    /**
+     * @brief Runs the modular images produced by xImage over batches of primes in parallel and reconstructs them with CRT.
+     *
+     * @param xCount Number of values produced per prime.
+     * @param xBoundBits log2 of a bound on the absolute values.
+     * @param xImage Callable (prime) -> std::optional<std::vector<std::uint64_t>>, empty for unlucky primes.
+     * @return The reconstructed values in the symmetric range.
+     * @exception std::overflow_error - If the primes needed for xBoundBits exceed what the accumulator of Type can hold.
+     */
+    template <typename Type, typename ImageFunc>
+    [[nodiscard]] std::vector<ModularAccumulator_t<Type>> multimodular_reconstruct(std::size_t xCount, double xBoundBits, const MultiModularOptions &xOptions,
+                                                                                   ImageFunc &&xImage)
+    {
+        using Acc = ModularAccumulator_t<Type>;
+        constexpr std::size_t kMaxPrimes = ModularAccumulator<Type>::kMaxPrimes;
+
+        // Every prime contributes at least 61 bits, one more bit for the sign; one extra prime as margin if it fits.
+        const auto tRequired = static_cast<std::size_t>(std::ceil((xBoundBits + 2) / 61.0));
+        if (tRequired > kMaxPrimes)
+            throw std::overflow_error("Bound exceeds the range of the reconstruction type.");
+        const auto tNeeded = std::min(kMaxPrimes, tRequired + 1);
+        const std::size_t tThreads = std::max<std::size_t>(1, xOptions.threads == 0 ? std::thread::hardware_concurrency() : xOptions.threads);
+
+        std::vector<ChineseRemainder<Acc>> tRemainders(xCount);
+        std::vector<Acc> tPrevious;
+        std::size_t tUsed = 0;
+        std::size_t tPrimeIndex = 0;
+        std::vector<std::uint64_t> tPrimes;
+
+        while (tUsed < tNeeded)
+        {
+            const auto tBatch = std::min(tThreads, tNeeded - tUsed);
+            if (tPrimes.size() < tPrimeIndex + tBatch)
+                tPrimes = word_primes(tPrimeIndex + tBatch + 8);
+
+            std::vector<std::future<std::optional<std::vector<std::uint64_t>>>> tFutures;
+            tFutures.reserve(tBatch);
+            for (std::size_t i = 0; i < tBatch; ++i)
+            {
+                const auto tPrime = tPrimes[tPrimeIndex + i];
+                tFutures.push_back(std::async(tBatch == 1 ? std::launch::deferred : std::launch::async, [&xImage, tPrime]() { return xImage(tPrime); }));
+            }
+
+            for (std::size_t i = 0; i < tBatch; ++i)
+            {
+                auto tImage = tFutures[i].get();
+                if (!tImage)
+                    continue;
+                for (std::size_t v = 0; v < xCount; ++v)
+                    tRemainders[v].add((*tImage)[v], tPrimes[tPrimeIndex + i]);
+                ++tUsed;
+            }
+            tPrimeIndex += tBatch;
+
+            if (xOptions.earlyTermination)
+            {
+                std::vector<Acc> tCurrent;
+                tCurrent.reserve(xCount);
+                for (const auto &tRemainder : tRemainders)
+                    tCurrent.push_back(tRemainder.symmetric());
+                if (tCurrent == tPrevious)
+                    break;
+                tPrevious = std::move(tCurrent);
+            }
+        }
+
+        std::vector<Acc> tResult;
+        tResult.reserve(xCount);
+        for (const auto &tRemainder : tRemainders)
+            tResult.push_back(tRemainder.symmetric());
+        return tResult;
+    }
+
+    /**
+     * @brief Converts a reconstructed accumulator value back to Type.
+     * @exception std::overflow_error - If the value does not fit into Type.
+     */
+    template <typename Type, typename Acc>
+    [[nodiscard]] Type narrow_reconstruction(const Acc &xValue) noexcept(false)
+    {
+        if constexpr (!std::is_same_v<Type, Acc>)
+        {
+            if (xValue > static_cast<Acc>(std::numeric_limits<Type>::max()) || xValue < static_cast<Acc>(std::numeric_limits<Type>::lowest()))
+                throw std::overflow_error("Result does not fit into the fraction's value type.");
+        }
+        return static_cast<Type>(xValue);
+    }
+
+    template <typename Type>
+    [[nodiscard]] std::vector<std::uint64_t> reduce_mod_p(const ClearedSystem<Type> &xSystem, std::uint64_t xPrime)
+    {
+        std::vector<std::uint64_t> tResidues;
+        tResidues.reserve(xSystem.data.size());
+        for (const auto &tEntry : xSystem.data)
+            tResidues.push_back(to_residue(tEntry, xPrime));
+        return tResidues;
+    }
+}
+
+/**
+ * @brief Calculates the exact determinant of a square rational matrix with a multi-modular algorithm.
+ *
+ * Denominators are cleared row by row, the integer determinant is computed modulo several word-size
+ * primes in parallel and reconstructed with the Chinese remainder theorem. The number of primes is
+ * bounded by Hadamard's bound; with earlyTermination the loop stops once the reconstruction is stable.
+ *
+ * For built-in value types the reconstruction runs in __int128 and is exact whenever the determinant of
+ * the cleared integer matrix fits into Type.
+ *
+ * @param xMatrix The square matrix.
+ * @param xOptions Parallelism and termination options.
+ * @return The determinant as simplified fraction.
+ * @exception std::invalid_argument - If the matrix is not square.
+ * @exception std::overflow_error - If the result does not fit into Type.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> multimodular_determinant(const FractionMatrix<Type> &xMatrix, const MultiModularOptions &xOptions = {}) noexcept(false)
+{
+    if (xMatrix.rows() != xMatrix.cols())
+        throw std::invalid_argument("Matrix must be square.");
+
+    const auto tSystem = fraction_detail::clear_denominators(xMatrix, {});
+    const auto n = tSystem.rows;
+    const auto tValues = fraction_detail::multimodular_reconstruct<Type>(
+        1, fraction_detail::hadamard_bound_bits(tSystem), xOptions,
+        [&tSystem, n](std::uint64_t xPrime) -> std::optional<std::vector<std::uint64_t>>
+        {
+            auto tResidues = fraction_detail::reduce_mod_p(tSystem, xPrime);
+            return std::vector<std::uint64_t>{fraction_detail::eliminate_mod_p(tResidues, n, n, xPrime)};
+        });
+
+    Fraction<Type> tResult{fraction_detail::narrow_reconstruction<Type>(tValues.front()), fraction_detail::scale_product(tSystem)};
+    return tResult.simplify();
+}
+
+/**
+ * @brief Solves the regular rational system A x = b exactly with a multi-modular algorithm.
+ *
+ * After clearing denominators, every prime yields x mod p and det(A) mod p from one elimination, which
+ * gives the Cramer numerators det(A_i) mod p. These integers are reconstructed with CRT and divided by
+ * the reconstructed determinant. Primes dividing the determinant are skipped.
+ *
+ * @param xMatrix The square coefficient matrix.
+ * @param xRhs The right-hand side.
+ * @param xOptions Parallelism and termination options.
+ * @return The solution as simplified fractions.
+ * @exception std::invalid_argument - If the dimensions do not match or the matrix is singular.
+ * @exception std::overflow_error - If an intermediate integer does not fit into Type.
+ */
+template <MathType Type>
+[[nodiscard]] std::vector<Fraction<Type>> multimodular_solve(const FractionMatrix<Type> &xMatrix, std::span<const Fraction<Type>> xRhs,
+                                                             const MultiModularOptions &xOptions = {}) noexcept(false)
+{
+    if (xMatrix.rows() != xMatrix.cols() || xRhs.size() != xMatrix.rows())
+        throw std::invalid_argument("Matrix must be square and match the right-hand side.");
+
+    const auto tSystem = fraction_detail::clear_denominators(xMatrix, xRhs);
+    const auto n = tSystem.rows;
+
+    // The determinant is needed first to tell a singular matrix from unlucky primes.
+    fraction_detail::ClearedSystem<Type> tSquare{n, n, {}, tSystem.scales};
+    tSquare.data.reserve(n * n);
+    for (std::size_t r = 0; r < n; ++r)
+        tSquare.data.insert(tSquare.data.end(), tSystem.data.begin() + static_cast<std::ptrdiff_t>(r * (n + 1)),
+                            tSystem.data.begin() + static_cast<std::ptrdiff_t>(r * (n + 1) + n));
+
+    const auto tDet = fraction_detail::multimodular_reconstruct<Type>(
+        1, fraction_detail::hadamard_bound_bits(tSquare), xOptions,
+        [&tSquare, n](std::uint64_t xPrime) -> std::optional<std::vector<std::uint64_t>>
+        {
+            auto tResidues = fraction_detail::reduce_mod_p(tSquare, xPrime);
+            return std::vector<std::uint64_t>{fraction_detail::eliminate_mod_p(tResidues, n, n, xPrime)};
+        });
+    if (tDet.front() == 0)
+        throw std::invalid_argument("Matrix is singular.");
+    const Type tDenominator = fraction_detail::narrow_reconstruction<Type>(tDet.front());
+
+    const auto tNumerators = fraction_detail::multimodular_reconstruct<Type>(
+        n, fraction_detail::hadamard_bound_bits(tSystem), xOptions,
+        [&tSystem, n](std::uint64_t xPrime) -> std::optional<std::vector<std::uint64_t>>
+        {
+            auto tResidues = fraction_detail::reduce_mod_p(tSystem, xPrime);
+            std::vector<std::uint64_t> tSolution;
+            const auto tDetModP = fraction_detail::eliminate_mod_p(tResidues, n, n + 1, xPrime, &tSolution);
+            if (tDetModP == 0)
+                return std::nullopt;
+            for (auto &tValue : tSolution)
+                tValue = mod_mul(tValue, tDetModP, xPrime);
+            return tSolution;
+        });
+
+    std::vector<Fraction<Type>> tResult;
+    tResult.reserve(n);
+    for (const auto &tNumerator : tNumerators)
+    {
+        Fraction<Type> tValue{fraction_detail::narrow_reconstruction<Type>(tNumerator), tDenominator};
+        tResult.push_back(tValue.simplify());
+    }
+    return tResult;
+}
+
+/**
+ * @brief Calculates the determinant with fraction-free Bareiss elimination on the cleared integer matrix.
+ *
+ * Reference algorithm for multimodular_determinant(). All intermediate values are minors of the
+ * integer matrix, so Type has to hold them.
+ *
+ * @exception std::invalid_argument - If the matrix is not square.
+ * @exception std::overflow_error - If an intermediate minor or the product of the row denominators overflows a built-in Type.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> bareiss_determinant(const FractionMatrix<Type> &xMatrix) noexcept(false)
+{
+    if (xMatrix.rows() != xMatrix.cols())
+        throw std::invalid_argument("Matrix must be square.");
+
+    auto tSystem = fraction_detail::clear_denominators(xMatrix, {});
+    const auto n = tSystem.rows;
+    auto &m = tSystem.data;
+    Type tPrevious{1};
+    bool tNegate = false;
+
+    for (std::size_t k = 0; k + 1 < n; ++k)
+    {
+        if (m[k * n + k] == Type(0))
+        {
+            std::size_t tPivot = k + 1;
+            while (tPivot < n && m[tPivot * n + k] == Type(0))
+                ++tPivot;
+            if (tPivot == n)
+                return Fraction<Type>{Type(0), Type(1)};
+            std::swap_ranges(m.begin() + static_cast<std::ptrdiff_t>(tPivot * n), m.begin() + static_cast<std::ptrdiff_t>((tPivot + 1) * n),
+                             m.begin() + static_cast<std::ptrdiff_t>(k * n));
+            tNegate = !tNegate;
+        }
+        for (std::size_t i = k + 1; i < n; ++i)
+        {
+            for (std::size_t j = k + 1; j < n; ++j)
+                m[i * n + j] = fraction_detail::checked_sub(fraction_detail::checked_mul(m[i * n + j], m[k * n + k]),
+                                                            fraction_detail::checked_mul(m[i * n + k], m[k * n + j])) /
+                               tPrevious;
+        }
+        tPrevious = m[k * n + k];
+    }
+
+    Type tDet = n == 0 ? Type(1) : m[n * n - 1];
+    if (tNegate)
+        tDet = -tDet;
+    Fraction<Type> tResult{tDet, fraction_detail::scale_product(tSystem)};
+    return tResult.simplify();
+}
+
+namespace fraction_detail
+{
+    /**
+     * @brief Calculates floor(sqrt(xValue)) with Newton's iteration on integers.
+     */
+    template <typename Acc>
+    [[nodiscard]] constexpr Acc integer_sqrt(const Acc &xValue)
+    {
+        if (xValue < Acc(2))
+            return xValue;
+        Acc x = xValue;
+        Acc y = (x + Acc(1)) / Acc(2);
+        while (y < x)
+        {
+            x = y;
+            y = (x + xValue / x) / Acc(2);
+        }
+        return x;
+    }
+
+    /**
+     * @brief Inverts an n x n matrix modulo xPrime with Gauss-Jordan elimination.
+     * @return The row-major inverse, or std::nullopt if the matrix is singular modulo xPrime.
+     */
+    [[nodiscard]] inline std::optional<std::vector<std::uint64_t>> inverse_mod_p(std::vector<std::uint64_t> xMatrix, std::size_t n, std::uint64_t xPrime)
+    {
+        std::vector<std::uint64_t> tInverse(n * n, 0);
+        for (std::size_t i = 0; i < n; ++i)
+            tInverse[i * n + i] = 1;
+
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::size_t tPivot = k;
+            while (tPivot < n && xMatrix[tPivot * n + k] == 0)
+                ++tPivot;
+            if (tPivot == n)
+                return std::nullopt;
+            if (tPivot != k)
+            {
+                for (std::size_t c = 0; c < n; ++c)
+                {
+                    std::swap(xMatrix[tPivot * n + c], xMatrix[k * n + c]);
+                    std::swap(tInverse[tPivot * n + c], tInverse[k * n + c]);
+                }
+            }
+
+            const auto tScale = mod_inverse(xMatrix[k * n + k], xPrime);
+            for (std::size_t c = 0; c < n; ++c)
+            {
+                xMatrix[k * n + c] = mod_mul(xMatrix[k * n + c], tScale, xPrime);
+                tInverse[k * n + c] = mod_mul(tInverse[k * n + c], tScale, xPrime);
+            }
+
+            for (std::size_t r = 0; r < n; ++r)
+            {
+                const auto tFactor = xMatrix[r * n + k];
+                if (r == k || tFactor == 0)
+                    continue;
+                for (std::size_t c = 0; c < n; ++c)
+                {
+                    xMatrix[r * n + c] = mod_sub(xMatrix[r * n + c], mod_mul(tFactor, xMatrix[k * n + c], xPrime), xPrime);
+                    tInverse[r * n + c] = mod_sub(tInverse[r * n + c], mod_mul(tFactor, tInverse[k * n + c], xPrime), xPrime);
+                }
+            }
+        }
+        return tInverse;
+    }
+}
+
+/**
+ * @brief Solves the regular rational system A x = b exactly with Dixon's p-adic lifting.
+ *
+ * Denominators are cleared row by row and A is inverted once modulo a prime p. Each lifting step
+ * then costs two integer matrix-vector products: the next p-adic digit is x_i = A^-1 r mod p and
+ * the residual becomes r = (r - A x_i) / p. The accumulated p-adic approximation is turned into
+ * fractions with rational_reconstruct(); a candidate is accepted once it satisfies A x = b exactly.
+ *
+ * Built-in value types lift with primes below 2^31 in __int128, which allows four digits and
+ * recovers solutions with numerators and denominators up to about 2^61. Custom types lift with
+ * word-size primes until Hadamard's bound is reached.
+ *
+ * @param xMatrix The square coefficient matrix.
+ * @param xRhs The right-hand side.
+ * @return The solution as simplified fractions.
+ * @exception std::invalid_argument - If the dimensions do not match or the matrix is singular.
+ * @exception std::overflow_error - If the solution cannot be represented with the available precision.
+ */
+template <MathType Type>
+[[nodiscard]] std::vector<Fraction<Type>> dixon_solve(const FractionMatrix<Type> &xMatrix, std::span<const Fraction<Type>> xRhs) noexcept(false)
+{
+    using Acc = ModularAccumulator_t<Type>;
+    constexpr bool kFixedWidth = !std::is_same_v<Acc, Type>;
+    constexpr std::uint64_t kPrimeLimit = kFixedWidth ? (1ull << 31) : (1ull << 62);
+
+    if (xMatrix.rows() != xMatrix.cols() || xRhs.size() != xMatrix.rows())
+        throw std::invalid_argument("Matrix must be square and match the right-hand side.");
+
+    const auto tSystem = fraction_detail::clear_denominators(xMatrix, xRhs);
+    const auto n = tSystem.rows;
+    const auto tEntry = [&tSystem, n](std::size_t r, std::size_t c) { return Acc(tSystem.data[r * (n + 1) + c]); };
+
+    // Factor A once modulo a prime that does not divide det(A).
+    std::uint64_t tPrime = 0;
+    std::vector<std::uint64_t> tInverse;
+    for (const auto tCandidate : word_primes(8, kPrimeLimit))
+    {
+        std::vector<std::uint64_t> tResidues;
+        tResidues.reserve(n * n);
+        for (std::size_t r = 0; r < n; ++r)
+            for (std::size_t c = 0; c < n; ++c)
+                tResidues.push_back(to_residue(tEntry(r, c), tCandidate));
+
+        if (auto tResult = fraction_detail::inverse_mod_p(std::move(tResidues), n, tCandidate))
+        {
+            tPrime = tCandidate;
+            tInverse = std::move(*tResult);
+            break;
+        }
+    }
+    if (tPrime == 0)
+        throw std::invalid_argument("Matrix is singular.");
+
+    // Numerators and the denominator of the solution are Cramer determinants, bounded by Hadamard.
+    const double tBoundBits = fraction_detail::hadamard_bound_bits(tSystem);
+    const auto tMaxSteps = kFixedWidth ? std::size_t{4} : static_cast<std::size_t>(std::ceil((2 * tBoundBits + 2) / std::log2(static_cast<double>(tPrime)))) + 1;
+
+    std::vector<Acc> tResidual(n);
+    for (std::size_t r = 0; r < n; ++r)
+        tResidual[r] = tEntry(r, n);
+    std::vector<Acc> tApproximation(n, Acc(0));
+    Acc tModulus{1};
+    std::vector<std::uint64_t> tDigit(n);
+
+    for (std::size_t tStep = 1; tStep <= tMaxSteps; ++tStep)
+    {
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            std::uint64_t tSum = 0;
+            for (std::size_t c = 0; c < n; ++c)
+                tSum = mod_add(tSum, mod_mul(tInverse[r * n + c], to_residue(tResidual[c], tPrime), tPrime), tPrime);
+            tDigit[r] = tSum;
+        }
+
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            Acc tProduct{0};
+            for (std::size_t c = 0; c < n; ++c)
+                tProduct = tProduct + tEntry(r, c) * Acc(tDigit[c]);
+            tResidual[r] = (tResidual[r] - tProduct) / Acc(tPrime);
+        }
+        for (std::size_t r = 0; r < n; ++r)
+            tApproximation[r] = tApproximation[r] + Acc(tDigit[r]) * tModulus;
+        tModulus = tModulus * Acc(tPrime);
+
+        // Reconstruction costs about as much as a lifting step, so only try it at powers of two.
+        if ((tStep & (tStep - 1)) != 0 && tStep != tMaxSteps)
+            continue;
+
+        const Acc tBound = fraction_detail::integer_sqrt(tModulus / Acc(2));
+        const auto tCandidate = rational_reconstruct<Acc>(std::span<const Acc>{tApproximation}, tModulus, tBound, tBound);
+        if (!tCandidate)
+            continue;
+
+        // Verify A y = b L with y = x L for the common denominator L of the candidate. A spurious
+        // candidate may have a common denominator far beyond the accumulator; if any product or sum
+        // of the check overflows, the candidate is rejected and lifting goes on.
+        const auto tVerify = [&tEntry, n](const std::vector<Fraction<Acc>> &xCandidate) {
+            using fraction_detail::add_overflows;
+            using fraction_detail::mul_overflows;
+
+            Acc tCommon{1};
+            for (const auto &tValue : xCandidate)
+            {
+                if (mul_overflows(Acc(tCommon / fraction_GCD(tCommon, tValue.getDenominator())), tValue.getDenominator(), tCommon))
+                    return false;
+            }
+
+            for (std::size_t r = 0; r < n; ++r)
+            {
+                Acc tSum{0};
+                for (std::size_t c = 0; c < n; ++c)
+                {
+                    Acc tScaled{0};
+                    Acc tTerm{0};
+                    if (mul_overflows(xCandidate[c].getNumerator(), Acc(tCommon / xCandidate[c].getDenominator()), tScaled) ||
+                        mul_overflows(tEntry(r, c), tScaled, tTerm) || add_overflows(tSum, tTerm, false, tSum))
+                        return false;
+                }
+                Acc tExpected{0};
+                if (mul_overflows(tEntry(r, n), tCommon, tExpected) || tSum != tExpected)
+                    return false;
+            }
+            return true;
+        };
+        if (!tVerify(*tCandidate))
+            continue;
+
+        std::vector<Fraction<Type>> tResult;
+        tResult.reserve(n);
+        for (const auto &tValue : *tCandidate)
+        {
+            tResult.emplace_back(fraction_detail::narrow_reconstruction<Type>(tValue.getNumerator()),
+                                 fraction_detail::narrow_reconstruction<Type>(tValue.getDenominator()));
+        }
+        return tResult;
+    }
+
+    throw std::overflow_error("Solution exceeds the precision available for lifting.");
+}
@@ -0,0 +1,476 @@
+#pragma once
+
+#include "Fraction.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Multiplies two residues modulo xModulus without overflowing 64 bits.
+ */
+[[nodiscard]] constexpr std::uint64_t mod_mul(std::uint64_t a, std::uint64_t b, std::uint64_t xModulus) noexcept
+{
+#ifdef __SIZEOF_INT128__
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(a) * b) % xModulus);
+#else
+    std::uint64_t tResult = 0;
+    a %= xModulus;
+    while (b != 0)
+    {
+        if (b & 1)
+            tResult = (tResult >= xModulus - a) ? tResult - (xModulus - a) : tResult + a;
+        a = (a >= xModulus - a) ? a - (xModulus - a) : a + a;
+        b >>= 1;
+    }
+    return tResult;
+#endif
+}
+
+/**
+ * @brief Adds two residues in [0, xModulus).
+ */
+[[nodiscard]] constexpr std::uint64_t mod_add(std::uint64_t a, std::uint64_t b, std::uint64_t xModulus) noexcept
+{
+    return (a >= xModulus - b) ? a - (xModulus - b) : a + b;
+}
+
+/**
+ * @brief Subtracts two residues in [0, xModulus).
+ */
+[[nodiscard]] constexpr std::uint64_t mod_sub(std::uint64_t a, std::uint64_t b, std::uint64_t xModulus) noexcept
+{
+    return (a >= b) ? a - b : a + (xModulus - b);
+}
+
+/**
+ * @brief Calculates xBase^xExp modulo xModulus by square and multiply.
+ */
+[[nodiscard]] constexpr std::uint64_t mod_pow(std::uint64_t xBase, std::uint64_t xExp, std::uint64_t xModulus) noexcept
+{
+    std::uint64_t tResult = 1 % xModulus;
+    xBase %= xModulus;
+    while (xExp != 0)
+    {
+        if (xExp & 1)
+            tResult = mod_mul(tResult, xBase, xModulus);
+        xBase = mod_mul(xBase, xBase, xModulus);
+        xExp >>= 1;
+    }
+    return tResult;
+}
+
+/**
+ * @brief Calculates the modular inverse with the extended Euclidean algorithm.
+ * @return The inverse of xValue modulo xModulus or 0 if xValue is not invertible.
+ */
+[[nodiscard]] constexpr std::uint64_t mod_inverse(std::uint64_t xValue, std::uint64_t xModulus) noexcept
+{
+    std::int64_t tOld = 0, tNew = 1;
+    std::uint64_t r0 = xModulus, r1 = xValue % xModulus;
+    while (r1 != 0)
+    {
+        const auto q = r0 / r1;
+        const auto tRest = r0 - q * r1;
+        r0 = r1;
+        r1 = tRest;
+        const auto tTemp = tOld - static_cast<std::int64_t>(q) * tNew;
+        tOld = tNew;
+        tNew = tTemp;
+    }
+    if (r0 != 1)
+        return 0;
+    return tOld < 0 ? static_cast<std::uint64_t>(tOld + static_cast<std::int64_t>(xModulus)) : static_cast<std::uint64_t>(tOld);
+}
+
+/**
+ * @brief Deterministic Miller-Rabin primality test for 64-bit values.
+ */
+[[nodiscard]] constexpr bool is_prime_u64(std::uint64_t xValue) noexcept
+{
+    if (xValue < 2)
+        return false;
+    for (std::uint64_t tSmall : {2ull, 3ull, 5ull, 7ull, 11ull, 13ull, 17ull, 19ull, 23ull, 29ull, 31ull, 37ull})
+    {
+        if (xValue % tSmall == 0)
+            return xValue == tSmall;
+    }
+
+    std::uint64_t d = xValue - 1;
+    int s = 0;
+    while ((d & 1) == 0)
+    {
+        d >>= 1;
+        ++s;
+    }
+
+    // These bases are sufficient for every 64-bit integer.
+    for (std::uint64_t tBase : {2ull, 3ull, 5ull, 7ull, 11ull, 13ull, 17ull, 19ull, 23ull, 29ull, 31ull, 37ull})
+    {
+        auto x = mod_pow(tBase, d, xValue);
+        if (x == 1 || x == xValue - 1)
+            continue;
+        bool tComposite = true;
+        for (int r = 1; r < s; ++r)
+        {
+            x = mod_mul(x, x, xValue);
+            if (x == xValue - 1)
+            {
+                tComposite = false;
+                break;
+            }
+        }
+        if (tComposite)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the prime factors of xValue in ascending order, repeated by multiplicity.
+ *
+ * Trial division by small primes, then Pollard's rho with Floyd cycle detection on the cofactor.
+ */
+[[nodiscard]] inline std::vector<std::uint64_t> factor_u64(std::uint64_t xValue)
+{
+    std::vector<std::uint64_t> tFactors;
+    for (std::uint64_t p = 2; p < 256 && p * p <= xValue; p += (p == 2 ? 1 : 2))
+    {
+        while (xValue % p == 0)
+        {
+            tFactors.push_back(p);
+            xValue /= p;
+        }
+    }
+
+    std::vector<std::uint64_t> tPending;
+    if (xValue > 1)
+        tPending.push_back(xValue);
+    while (!tPending.empty())
+    {
+        const std::uint64_t n = tPending.back();
+        tPending.pop_back();
+        if (is_prime_u64(n))
+        {
+            tFactors.push_back(n);
+            continue;
+        }
+        std::uint64_t tDivisor = n;
+        for (std::uint64_t c = 1; tDivisor == n; ++c)
+        {
+            std::uint64_t x = 2, y = 2;
+            tDivisor = 1;
+            while (tDivisor == 1)
+            {
+                x = mod_add(mod_mul(x, x, n), c, n);
+                y = mod_add(mod_mul(y, y, n), c, n);
+                y = mod_add(mod_mul(y, y, n), c, n);
+                tDivisor = fraction_GCD(x > y ? x - y : y - x, n);
+            }
+        }
+        tPending.push_back(tDivisor);
+        tPending.push_back(n / tDivisor);
+    }
+    std::sort(tFactors.begin(), tFactors.end());
+    return tFactors;
+}
+
+/**
+ * @brief Returns the multiplicative order of xBase modulo xModulus, the smallest k > 0 with xBase^k = 1.
+ *
+ * Starts from Euler's phi(xModulus) and divides out every prime factor as long as the power stays 1.
+ *
+ * @pre gcd(xBase, xModulus) == 1 and xModulus > 1.
+ */
+[[nodiscard]] inline std::uint64_t multiplicative_order(std::uint64_t xBase, std::uint64_t xModulus)
+{
+    const auto tFactors = factor_u64(xModulus);
+    std::uint64_t tPhi = 1;
+    std::vector<std::uint64_t> tPhiPrimes;
+    for (std::size_t i = 0; i < tFactors.size(); ++i)
+    {
+        const bool tRepeated = i > 0 && tFactors[i] == tFactors[i - 1];
+        tPhi *= tRepeated ? tFactors[i] : tFactors[i] - 1;
+        if (tRepeated)
+            continue;
+        tPhiPrimes.push_back(tFactors[i]);
+        for (const auto q : factor_u64(tFactors[i] - 1))
+            tPhiPrimes.push_back(q);
+    }
+    std::sort(tPhiPrimes.begin(), tPhiPrimes.end());
+    tPhiPrimes.erase(std::unique(tPhiPrimes.begin(), tPhiPrimes.end()), tPhiPrimes.end());
+
+    std::uint64_t tOrder = tPhi;
+    for (const auto q : tPhiPrimes)
+    {
+        while (tOrder % q == 0 && mod_pow(xBase, tOrder / q, xModulus) == 1)
+            tOrder /= q;
+    }
+    return tOrder;
+}
+
+/**
+ * @brief Returns the xCount largest primes below xBelow in descending order.
+ *
+ * The default bound of 2^62 keeps mod_add() and the Lehmer-style cofactor arithmetic free of overflows.
+ */
+[[nodiscard]] inline std::vector<std::uint64_t> word_primes(std::size_t xCount, std::uint64_t xBelow = (1ull << 62))
+{
+    std::vector<std::uint64_t> tPrimes;
+    tPrimes.reserve(xCount);
+    for (std::uint64_t tCandidate = (xBelow - 1) | 1; tPrimes.size() < xCount && tCandidate > 2; tCandidate -= 2)
+    {
+        if (is_prime_u64(tCandidate))
+            tPrimes.push_back(tCandidate);
+    }
+    return tPrimes;
+}
+
+/**
+ * @brief Maps an integer value of Type onto its residue in [0, xPrime).
+ *
+ * Custom types must be constructible from std::uint64_t, support % and be convertible to std::uint64_t.
+ */
+template <typename Type>
+[[nodiscard]] constexpr std::uint64_t to_residue(const Type &xValue, std::uint64_t xPrime)
+{
+    if constexpr (std::is_unsigned_v<Type>)
+    {
+        return static_cast<std::uint64_t>(xValue % xPrime);
+    }
+    else if constexpr (std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::int64_t))
+    {
+        const auto tRest = static_cast<std::int64_t>(xValue) % static_cast<std::int64_t>(xPrime);
+        return static_cast<std::uint64_t>(tRest < 0 ? tRest + static_cast<std::int64_t>(xPrime) : tRest);
+    }
+    else
+    {
+        const Type tPrime(xPrime);
+        Type tRest = xValue % tPrime;
+        if (tRest < Type(0))
+            tRest = tRest + tPrime;
+        return static_cast<std::uint64_t>(tRest);
+    }
+}
+
+namespace fraction_detail
+{
+    template <typename Type>
+    struct ModularAccumulator
+    {
+        using type = Type;
+        static constexpr std::size_t kMaxPrimes = static_cast<std::size_t>(-1);
+    };
+
+#ifdef __SIZEOF_INT128__
+    template <typename Type>
+        requires(std::is_integral_v<Type> && sizeof(Type) <= sizeof(std::int64_t))
+    struct ModularAccumulator<Type>
+    {
+        using type = __int128;
+        // Two primes below 2^62 give a modulus below 2^124, which still fits __int128.
+        static constexpr std::size_t kMaxPrimes = 2;
+    };
+#endif
+}
+
+/**
+ * @brief Integer type wide enough to run the Chinese remainder reconstruction for Type.
+ *
+ * Built-in integers up to 64 bits use __int128 (if available), every other type reconstructs in itself.
+ */
+template <typename Type>
+using ModularAccumulator_t = typename fraction_detail::ModularAccumulator<Type>::type;
+
+/**
+ * @brief Incremental Chinese remainder reconstruction (Garner's algorithm).
+ *
+ * Keeps the value in [0, modulus) and the product of all primes added so far.
+ *
+ * @tparam Acc The integer type used for the reconstruction, see ModularAccumulator_t.
+ */
+template <typename Acc>
+class ChineseRemainder
+{
+    Acc mValue{0};   ///< Reconstructed value in [0, mModulus).
+    Acc mModulus{1}; ///< Product of all primes added so far.
+
+public:
+    /**
+     * @brief Adds the image xResidue modulo xPrime.
+     * @param xResidue The residue in [0, xPrime).
+     * @param xPrime The prime, coprime to all primes added before.
+     */
+    constexpr void add(std::uint64_t xResidue, std::uint64_t xPrime)
+    {
+        const auto tValueModP = to_residue(mValue, xPrime);
+        const auto tModulusModP = to_residue(mModulus, xPrime);
+        const auto tFactor = mod_mul(mod_sub(xResidue, tValueModP, xPrime), mod_inverse(tModulusModP, xPrime), xPrime);
+
+        mValue = mValue + mModulus * Acc(tFactor);
+        mModulus = mModulus * Acc(xPrime);
+    }
+
+    /**
+     * @brief Returns the reconstructed value in [0, modulus).
+     */
+    [[nodiscard]] constexpr const Acc &getValue() const noexcept
+    {
+        return mValue;
+    }
+
+    /**
+     * @brief Returns the product of all primes added so far.
+     */
+    [[nodiscard]] constexpr const Acc &getModulus() const noexcept
+    {
+        return mModulus;
+    }
+
+    /**
+     * @brief Returns the reconstructed value in the symmetric range (-modulus / 2, modulus / 2].
+     */
+    [[nodiscard]] constexpr Acc symmetric() const
+    {
+        if (mValue > mModulus / Acc(2))
+            return mValue - mModulus;
+        return mValue;
+    }
+};
+
+/**
+ * @brief Calculates a * b modulo xModulus for values of Type without intermediate overflow.
+ *
+ * Built-in integers up to 64 bits multiply in ModularAccumulator_t, __int128 uses double and add
+ * and custom types multiply in themselves. The result is in [0, xModulus) for non-negative inputs.
+ */
+template <typename Type>
+[[nodiscard]] constexpr Type wide_mod_mul(const Type &a, const Type &b, const Type &xModulus)
+{
+#ifdef __SIZEOF_INT128__
+    if constexpr (std::is_same_v<Type, __int128>)
+    {
+        // No wider type available: double and add, the modulus has to stay below 2^126.
+        using Unsigned_t = unsigned __int128;
+        const auto tModulus = static_cast<Unsigned_t>(xModulus);
+        auto tA = static_cast<Unsigned_t>(a < 0 ? a % xModulus + xModulus : a % xModulus);
+        auto tB = static_cast<Unsigned_t>(b < 0 ? b % xModulus + xModulus : b % xModulus);
+        Unsigned_t tResult = 0;
+        while (tB != 0)
+        {
+            if (tB & 1)
+                tResult = (tResult + tA) % tModulus;
+            tA = (tA + tA) % tModulus;
+            tB >>= 1;
+        }
+        return static_cast<Type>(tResult);
+    }
+#endif
+    using Acc = ModularAccumulator_t<Type>;
+    Acc tResult = (Acc(a) * Acc(b)) % Acc(xModulus);
+    if (tResult < Acc(0))
+        tResult = tResult + Acc(xModulus);
+    return static_cast<Type>(tResult);
+}
+
+/**
+ * @brief Recovers the fraction n/d from its image xResidue modulo xModulus.
+ *
+ * Runs the extended Euclidean algorithm on (xModulus, xResidue) only until the remainder drops to
+ * xNumBound (half-extended Euclid, Wang's algorithm). The result is unique if
+ * 2 * xNumBound * xDenBound < xModulus.
+ *
+ * @param xResidue The image of the fraction modulo xModulus.
+ * @param xModulus The modulus, usually a prime or prime power.
+ * @param xNumBound Bound on the absolute value of the numerator.
+ * @param xDenBound Bound on the denominator.
+ * @return The simplified fraction with positive denominator, or std::nullopt if no fraction within the bounds matches.
+ */
+template <MathType Type>
+    requires(!std::is_unsigned_v<Type>)
+[[nodiscard]] constexpr std::optional<Fraction<Type>> rational_reconstruct(const Type &xResidue, const Type &xModulus, const Type &xNumBound,
+                                                                           const Type &xDenBound)
+{
+    Type r0 = xModulus;
+    Type r1 = xResidue % xModulus;
+    if (r1 < Type(0))
+        r1 = r1 + xModulus;
+    Type t0{0};
+    Type t1{1};
+
+    while (r1 > xNumBound)
+    {
+        const Type q = r0 / r1;
+        Type tTemp = r0 - q * r1;
+        r0 = r1;
+        r1 = tTemp;
+        tTemp = t0 - q * t1;
+        t0 = t1;
+        t1 = tTemp;
+    }
+
+    if (t1 < Type(0))
+    {
+        r1 = -r1;
+        t1 = -t1;
+    }
+    if (t1 == Type(0) || t1 > xDenBound || fraction_GCD(r1, t1) != Type(1))
+        return std::nullopt;
+
+    return Fraction<Type>{r1, t1};
+}
+
+/**
+ * @brief Recovers a vector of fractions from their images modulo xModulus.
+ *
+ * Keeps the common denominator L of all fractions recovered so far. Each further residue is
+ * multiplied by L first, which usually leaves a small integer and skips the Euclidean loop,
+ * so vectors with a shared denominator (typical for linear system solutions) cost one
+ * reconstruction plus one multiplication per entry. Entries whose scaled image is not small are
+ * reconstructed on their own, and their denominator joins L while L stays within xDenBound.
+ *
+ * @return The fractions, or std::nullopt if any entry has no reconstruction within the bounds.
+ */
+template <MathType Type>
+    requires(!std::is_unsigned_v<Type>)
+[[nodiscard]] std::optional<std::vector<Fraction<Type>>> rational_reconstruct(std::span<const Type> xResidues, const Type &xModulus, const Type &xNumBound,
+                                                                              const Type &xDenBound)
+{
+    std::vector<Fraction<Type>> tResult;
+    tResult.reserve(xResidues.size());
+    Type tCommon{1};
+
+    for (const auto &tResidue : xResidues)
+    {
+        Type tReduced = tResidue % xModulus;
+        if (tReduced < Type(0))
+            tReduced = tReduced + xModulus;
+        Type tScaled = wide_mod_mul(tReduced, tCommon, xModulus);
+        if (tScaled > xModulus / Type(2))
+            tScaled = tScaled - xModulus;
+
+        if (tScaled <= xNumBound && -tScaled <= xNumBound)
+        {
+            Fraction<Type> tValue{tScaled, tCommon};
+            tResult.push_back(tValue.simplify());
+            continue;
+        }
+
+        // The scaled numerator is no longer bounded by xNumBound, so reconstruct the entry itself.
+        const auto tValue = rational_reconstruct(tReduced, xModulus, xNumBound, xDenBound);
+        if (!tValue)
+            return std::nullopt;
+        tResult.push_back(*tValue);
+
+        // Both factors are at most xDenBound, so the product cannot exceed xModulus.
+        const Type tLcm = tCommon / fraction_GCD(tCommon, tValue->getDenominator()) * tValue->getDenominator();
+        if (tLcm <= xDenBound)
+            tCommon = tLcm;
+    }
+    return tResult;
+}
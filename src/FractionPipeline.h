@@ -0,0 +1,386 @@
+#pragma once
+
+#include "Fraction.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lazy sequence produced by a coroutine with co_yield, usable in a range-based for loop.
+ *
+ * An exception thrown in the coroutine is rethrown from begin() or operator++.
+ */
+template <typename Value>
+class FractionGenerator
+{
+public:
+    struct promise_type
+    {
+        std::optional<Value> mValue{};          ///< Last yielded value.
+        std::exception_ptr mException{nullptr}; ///< Exception that ended the coroutine.
+
+        FractionGenerator get_return_object() noexcept
+        {
+            return FractionGenerator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(Value xValue) noexcept(std::is_nothrow_move_constructible_v<Value>)
+        {
+            mValue.emplace(std::move(xValue));
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            mException = std::current_exception();
+        }
+    };
+
+    class iterator
+    {
+        std::coroutine_handle<promise_type> mHandle{nullptr};
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = Value;
+
+        iterator() = default;
+
+        explicit iterator(std::coroutine_handle<promise_type> xHandle) noexcept : mHandle{xHandle}
+        {
+        }
+
+        [[nodiscard]] Value &operator*() const noexcept
+        {
+            return *mHandle.promise().mValue;
+        }
+
+        iterator &operator++() noexcept(false)
+        {
+            resume(mHandle);
+            return *this;
+        }
+
+        void operator++(int) noexcept(false)
+        {
+            ++*this;
+        }
+
+        [[nodiscard]] friend bool operator==(const iterator &xIterator, std::default_sentinel_t) noexcept
+        {
+            return xIterator.mHandle == nullptr || xIterator.mHandle.done();
+        }
+    };
+
+    FractionGenerator(FractionGenerator &&xOther) noexcept : mHandle{std::exchange(xOther.mHandle, nullptr)}
+    {
+    }
+
+    FractionGenerator &operator=(FractionGenerator &&xOther) noexcept
+    {
+        if (this != &xOther)
+        {
+            if (mHandle)
+                mHandle.destroy();
+            mHandle = std::exchange(xOther.mHandle, nullptr);
+        }
+        return *this;
+    }
+
+    FractionGenerator(const FractionGenerator &) = delete;
+    FractionGenerator &operator=(const FractionGenerator &) = delete;
+
+    ~FractionGenerator()
+    {
+        if (mHandle)
+            mHandle.destroy();
+    }
+
+    /**
+     * @brief Runs the coroutine to its first co_yield. Call it once.
+     */
+    [[nodiscard]] iterator begin() noexcept(false)
+    {
+        resume(mHandle);
+        return iterator{mHandle};
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+
+private:
+    std::coroutine_handle<promise_type> mHandle{nullptr};
+
+    explicit FractionGenerator(std::coroutine_handle<promise_type> xHandle) noexcept : mHandle{xHandle}
+    {
+    }
+
+    static void resume(std::coroutine_handle<promise_type> xHandle) noexcept(false)
+    {
+        if (!xHandle || xHandle.done())
+            return;
+        xHandle.promise().mValue.reset();
+        xHandle.resume();
+        if (xHandle.promise().mException)
+            std::rethrow_exception(std::exchange(xHandle.promise().mException, nullptr));
+    }
+};
+
+/**
+ * @brief Blocking queue with a fixed capacity that connects two pipeline stages.
+ *
+ * push() blocks while the queue is full, so a fast producer is throttled to the speed of its
+ * consumer instead of buffering without bound.
+ */
+template <typename Value>
+class BoundedChannel
+{
+    std::mutex mMutex;
+    std::condition_variable mNotFull;
+    std::condition_variable mNotEmpty;
+    std::deque<Value> mQueue;
+    std::size_t mCapacity;
+    bool mClosed{false};
+
+public:
+    /**
+     * @exception std::invalid_argument - If xCapacity is 0.
+     */
+    explicit BoundedChannel(std::size_t xCapacity) noexcept(false) : mCapacity{xCapacity}
+    {
+        if (xCapacity == 0)
+            throw std::invalid_argument("Capacity must be unequal zero.");
+    }
+
+    /**
+     * @brief Waits for a free slot and appends xValue.
+     * @return false if the channel was closed, xValue is dropped then.
+     */
+    bool push(Value xValue)
+    {
+        std::unique_lock tLock{mMutex};
+        mNotFull.wait(tLock, [this] { return mClosed || mQueue.size() < mCapacity; });
+        if (mClosed)
+            return false;
+        mQueue.push_back(std::move(xValue));
+        mNotEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Waits for a value; returns std::nullopt once the channel is closed and drained.
+     */
+    [[nodiscard]] std::optional<Value> pop()
+    {
+        std::unique_lock tLock{mMutex};
+        mNotEmpty.wait(tLock, [this] { return mClosed || !mQueue.empty(); });
+        if (mQueue.empty())
+            return std::nullopt;
+        std::optional<Value> tValue{std::move(mQueue.front())};
+        mQueue.pop_front();
+        mNotFull.notify_one();
+        return tValue;
+    }
+
+    /**
+     * @brief Ends the stream; queued values can still be popped unless xDiscard is set.
+     */
+    void close(bool xDiscard = false)
+    {
+        std::lock_guard tLock{mMutex};
+        mClosed = true;
+        if (xDiscard)
+            mQueue.clear();
+        mNotFull.notify_all();
+        mNotEmpty.notify_all();
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return mCapacity;
+    }
+};
+
+/**
+ * @brief Batch of fractions passed between pipeline stages.
+ */
+template <MathType Type>
+using FractionBatch = std::vector<Fraction<Type>>;
+
+namespace fraction_detail
+{
+    template <MathType Type>
+    FractionGenerator<FractionBatch<Type>> batched(std::span<const Fraction<Type>> xValues, std::size_t xBatchSize)
+    {
+        for (std::size_t i = 0; i < xValues.size(); i += xBatchSize)
+        {
+            const auto tBatch = xValues.subspan(i, std::min(xBatchSize, xValues.size() - i));
+            co_yield FractionBatch<Type>(tBatch.begin(), tBatch.end());
+        }
+    }
+}
+
+/**
+ * @brief Yields xValues in batches of at most xBatchSize fractions.
+ * @exception std::invalid_argument - If xBatchSize is 0, thrown here and not on the first resume.
+ */
+template <MathType Type>
+[[nodiscard]] FractionGenerator<FractionBatch<Type>> batched(std::span<const Fraction<Type>> xValues, std::size_t xBatchSize) noexcept(false)
+{
+    if (xBatchSize == 0)
+        throw std::invalid_argument("Batch size must be unequal zero.");
+    return fraction_detail::batched(xValues, xBatchSize);
+}
+
+/**
+ * @brief Chain of batch transforms (e.g. parse, normalize, quantize) that run concurrently.
+ *
+ * run() starts one thread for the source and one per stage and connects them with
+ * BoundedChannels, so the stages work on consecutive batches at the same time and the slowest one
+ * throttles the others. The sink runs on the calling thread. If any stage or the sink throws, all
+ * channels are closed, every thread is joined and the first exception is rethrown.
+ */
+template <MathType Type>
+class FractionPipeline
+{
+    std::vector<std::function<void(FractionBatch<Type> &)>> mStages{}; ///< Transforms in order.
+    std::size_t mCapacity;                                              ///< Batches queued between two stages.
+
+public:
+    /**
+     * @param xCapacity Number of batches that can wait between two stages.
+     * @exception std::invalid_argument - If xCapacity is 0.
+     */
+    explicit FractionPipeline(std::size_t xCapacity = 4) noexcept(false) : mCapacity{xCapacity}
+    {
+        if (xCapacity == 0)
+            throw std::invalid_argument("Capacity must be unequal zero.");
+    }
+
+    /**
+     * @brief Appends a stage that transforms each batch in place.
+     */
+    FractionPipeline &then(std::function<void(FractionBatch<Type> &)> xStage)
+    {
+        mStages.push_back(std::move(xStage));
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t stages() const noexcept
+    {
+        return mStages.size();
+    }
+
+    /**
+     * @brief Streams every batch of xSource through all stages into xSink.
+     * @param xSink Callable taking FractionBatch<Type>&&, called in order of the source.
+     */
+    template <typename Sink>
+    void run(FractionGenerator<FractionBatch<Type>> xSource, Sink &&xSink) noexcept(false)
+    {
+        std::vector<std::unique_ptr<BoundedChannel<FractionBatch<Type>>>> tChannels;
+        for (std::size_t i = 0; i <= mStages.size(); ++i)
+            tChannels.push_back(std::make_unique<BoundedChannel<FractionBatch<Type>>>(mCapacity));
+
+        std::mutex tErrorMutex;
+        std::exception_ptr tError{nullptr};
+        const auto tFail = [&]()
+        {
+            {
+                std::lock_guard tLock{tErrorMutex};
+                if (!tError)
+                    tError = std::current_exception();
+            }
+            for (auto &tChannel : tChannels)
+                tChannel->close(true);
+        };
+
+        {
+            std::vector<std::jthread> tThreads;
+            tThreads.reserve(mStages.size() + 1);
+            tThreads.emplace_back(
+                [&]()
+                {
+                    try
+                    {
+                        for (auto &tBatch : xSource)
+                        {
+                            if (!tChannels.front()->push(std::move(tBatch)))
+                                return;
+                        }
+                        tChannels.front()->close();
+                    }
+                    catch (...)
+                    {
+                        tFail();
+                    }
+                });
+            for (std::size_t s = 0; s < mStages.size(); ++s)
+            {
+                tThreads.emplace_back(
+                    [&, s]()
+                    {
+                        try
+                        {
+                            while (auto tBatch = tChannels[s]->pop())
+                            {
+                                mStages[s](*tBatch);
+                                if (!tChannels[s + 1]->push(std::move(*tBatch)))
+                                    return;
+                            }
+                            tChannels[s + 1]->close();
+                        }
+                        catch (...)
+                        {
+                            tFail();
+                        }
+                    });
+            }
+
+            try
+            {
+                while (auto tBatch = tChannels.back()->pop())
+                    xSink(std::move(*tBatch));
+            }
+            catch (...)
+            {
+                tFail();
+            }
+        }
+
+        if (tError)
+            std::rethrow_exception(tError);
+    }
+};
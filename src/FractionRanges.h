@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Fraction.h"
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Lazy range adaptors for fraction ranges, e.g. values | fraction_views::simplified | fraction_views::to_double.
+ *
+ * simplified, to_double and from_double are element-wise transform views: they keep the
+ * random access of the underlying range, allocate nothing and can be handed to the parallel
+ * standard algorithms. partial_sums carries the running sum and is a forward range; for a parallel
+ * prefix sum over a materialized array use inclusive_scan() from FractionAlgorithm.h.
+ */
+namespace fraction_views
+{
+    /**
+     * @brief Yields every fraction simplified.
+     */
+    inline constexpr auto simplified = std::views::transform(
+        []<MathType Type>(Fraction<Type> xValue)
+        {
+            xValue.simplify();
+            return xValue;
+        });
+
+    /**
+     * @brief Yields every fraction as double.
+     */
+    inline constexpr auto to_double = std::views::transform([]<MathType Type>(const Fraction<Type> &xValue) { return xValue.to_double(); });
+
+    /**
+     * @brief Yields the closest fraction with a denominator of at most xMaxDenominator for every floating point value.
+     * @see to_Fraction_bounded()
+     */
+    template <MathType Type>
+        requires std::is_integral_v<Type>
+    [[nodiscard]] constexpr auto from_double(Type xMaxDenominator)
+    {
+        return std::views::transform([xMaxDenominator]<typename Arg_t>(Arg_t xValue)
+                                         requires std::is_floating_point_v<Arg_t>
+                                     { return to_Fraction_bounded(xValue, xMaxDenominator); });
+    }
+
+    /**
+     * @brief View of the running sums of a fraction range, each sum simplified.
+     */
+    template <std::ranges::input_range View>
+        requires std::ranges::view<View>
+    class partial_sums_view : public std::ranges::view_interface<partial_sums_view<View>>
+    {
+        using Value_t = std::remove_cvref_t<std::ranges::range_reference_t<View>>;
+
+        View mBase{};
+
+        class iterator
+        {
+            std::ranges::iterator_t<View> mCurrent{};
+            std::ranges::sentinel_t<View> mEnd{};
+            std::optional<Value_t> mSum{}; ///< Sum up to and including *mCurrent, empty at the end.
+
+            void load()
+            {
+                if (mCurrent == mEnd)
+                {
+                    mSum.reset();
+                    return;
+                }
+                if (mSum)
+                    *mSum += *mCurrent;
+                else
+                    mSum.emplace(*mCurrent);
+                mSum->simplify();
+            }
+
+        public:
+            using iterator_concept = std::conditional_t<std::ranges::forward_range<View>, std::forward_iterator_tag, std::input_iterator_tag>;
+            using value_type = Value_t;
+            using difference_type = std::ranges::range_difference_t<View>;
+
+            iterator() = default;
+
+            iterator(std::ranges::iterator_t<View> xCurrent, std::ranges::sentinel_t<View> xEnd) : mCurrent{std::move(xCurrent)}, mEnd{std::move(xEnd)}
+            {
+                load();
+            }
+
+            /**
+             * @brief Returns the running sum by value; a reference into the iterator would dangle once it advances.
+             */
+            [[nodiscard]] Value_t operator*() const
+            {
+                return *mSum;
+            }
+
+            iterator &operator++()
+            {
+                ++mCurrent;
+                load();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto tCopy = *this;
+                ++*this;
+                return tCopy;
+            }
+
+            [[nodiscard]] friend bool operator==(const iterator &lhs, const iterator &rhs)
+                requires std::equality_comparable<std::ranges::iterator_t<View>>
+            {
+                return lhs.mCurrent == rhs.mCurrent;
+            }
+
+            [[nodiscard]] friend bool operator==(const iterator &xIterator, std::default_sentinel_t) noexcept
+            {
+                return !xIterator.mSum.has_value();
+            }
+        };
+
+    public:
+        partial_sums_view() = default;
+
+        explicit partial_sums_view(View xBase) : mBase{std::move(xBase)}
+        {
+        }
+
+        [[nodiscard]] iterator begin()
+        {
+            return iterator{std::ranges::begin(mBase), std::ranges::end(mBase)};
+        }
+
+        [[nodiscard]] std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+        [[nodiscard]] auto size()
+            requires std::ranges::sized_range<View>
+        {
+            return std::ranges::size(mBase);
+        }
+    };
+
+    template <typename Range>
+    partial_sums_view(Range &&) -> partial_sums_view<std::views::all_t<Range>>;
+
+    /**
+     * @brief Range adaptor object for partial_sums_view, usable as partial_sums(r) and r | partial_sums.
+     */
+    struct PartialSumsAdaptor
+    {
+        template <std::ranges::viewable_range Range>
+        [[nodiscard]] constexpr auto operator()(Range &&xRange) const
+        {
+            return partial_sums_view{std::forward<Range>(xRange)};
+        }
+
+        template <std::ranges::viewable_range Range>
+        [[nodiscard]] friend constexpr auto operator|(Range &&xRange, const PartialSumsAdaptor &xAdaptor)
+        {
+            return xAdaptor(std::forward<Range>(xRange));
+        }
+    };
+
+    inline constexpr PartialSumsAdaptor partial_sums{};
+}
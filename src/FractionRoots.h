@@ -0,0 +1,483 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionAlgorithm.h"
+#include "FractionChecked.h"
+#include "FractionColumn.h"
+#include "FractionModular.h"
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Options for isolate_real_roots().
+ */
+struct RootIsolationOptions
+{
+    /// Number of worker threads, 0 selects std::thread::hardware_concurrency().
+    std::size_t threads = 0;
+    /// Polynomials of lower degree are isolated on the calling thread only.
+    std::size_t parallelDegree = 32;
+};
+
+/**
+ * @brief Interval that contains exactly one real root.
+ *
+ * Either lower == upper and the root is this rational number, or lower < upper and the root lies in
+ * the open interval (lower, upper).
+ */
+template <MathType Type>
+struct RootInterval
+{
+    Fraction<Type> lower;
+    Fraction<Type> upper;
+
+    /**
+     * @brief Returns true if the root is rational and equal to lower and upper.
+     */
+    [[nodiscard]] constexpr bool isExact() const noexcept
+    {
+        return fraction_detail::cross_compare(lower.getNumerator(), lower.getDenominator(), upper.getNumerator(), upper.getDenominator()) == 0;
+    }
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Returns the number of significant bits of |xValue|.
+     */
+    template <typename Int>
+    [[nodiscard]] constexpr int bit_length(const Int &xValue) noexcept
+    {
+        if constexpr (std::is_integral_v<Int>)
+        {
+            using Unsigned_t = std::make_unsigned_t<Int>;
+            const auto tValue = static_cast<Unsigned_t>(xValue);
+            return static_cast<int>(std::bit_width(xValue < Int(0) ? static_cast<Unsigned_t>(Unsigned_t(0) - tValue) : tValue));
+        }
+        else
+        {
+            Int tValue = gcd_abs(xValue);
+            int tBits = 0;
+            for (; tValue != Int(0); tValue = tValue / Int(2))
+                ++tBits;
+            return tBits;
+        }
+    }
+
+    /// Integer polynomial, coefficient i belongs to x^i, no leading zeros.
+    template <typename Int>
+    using Polynomial = std::vector<Int>;
+
+    template <typename Int>
+    void poly_trim(Polynomial<Int> &xPoly)
+    {
+        while (!xPoly.empty() && xPoly.back() == Int(0))
+            xPoly.pop_back();
+    }
+
+    /**
+     * @brief Divides by the content and makes the leading coefficient positive.
+     */
+    template <typename Int>
+    void poly_primitive(Polynomial<Int> &xPoly)
+    {
+        Int tContent{0};
+        for (const auto &tCoefficient : xPoly)
+            tContent = fraction_GCD(tContent, tCoefficient);
+        if (tContent == Int(0))
+            return;
+        if (xPoly.back() < Int(0))
+            tContent = -tContent;
+        for (auto &tCoefficient : xPoly)
+            tCoefficient = tCoefficient / tContent;
+    }
+
+    /**
+     * @brief Returns a constant multiple of the remainder of a divided by b, with integer coefficients only.
+     */
+    template <typename Int>
+    [[nodiscard]] Polynomial<Int> poly_pseudo_remainder(Polynomial<Int> a, const Polynomial<Int> &b)
+    {
+        while (a.size() >= b.size())
+        {
+            // Only the remainder up to a constant factor is needed, so scale by the cofactors of the
+            // leading coefficients and remove the content after every step to keep the numbers small.
+            const Int tGCD = fraction_GCD(a.back(), b.back());
+            const Int tLead = a.back() / tGCD;
+            const Int tScale = b.back() / tGCD;
+            const std::size_t tShift = a.size() - b.size();
+            for (auto &tCoefficient : a)
+                tCoefficient = checked_mul(tCoefficient, tScale);
+            for (std::size_t i = 0; i < b.size(); ++i)
+                a[i + tShift] = checked_add(a[i + tShift], -checked_mul(tLead, b[i]));
+            poly_trim(a);
+            poly_primitive(a);
+        }
+        return a;
+    }
+
+    /**
+     * @brief Returns the primitive greatest common divisor with a positive leading coefficient.
+     */
+    template <typename Int>
+    [[nodiscard]] Polynomial<Int> poly_gcd(Polynomial<Int> a, Polynomial<Int> b)
+    {
+        poly_primitive(a);
+        poly_primitive(b);
+        while (!b.empty())
+        {
+            auto tRemainder = poly_pseudo_remainder(a, b);
+            poly_primitive(tRemainder);
+            a = std::move(b);
+            b = std::move(tRemainder);
+        }
+        return a;
+    }
+
+    /**
+     * @brief Returns true if xPoly is square-free modulo xPrime and xPrime does not divide its leading coefficient.
+     *
+     * Then xPoly is square-free over the integers as well: the degree of gcd(p, p') can only grow
+     * modulo a prime that keeps the degree. Costs O(n^2) word operations without coefficient growth.
+     */
+    template <typename Int>
+    [[nodiscard]] bool poly_squarefree_mod_p(const Polynomial<Int> &xPoly, std::uint64_t xPrime)
+    {
+        std::vector<std::uint64_t> a(xPoly.size());
+        for (std::size_t i = 0; i < xPoly.size(); ++i)
+            a[i] = to_residue(xPoly[i], xPrime);
+        if (a.back() == 0)
+            return false;
+
+        std::vector<std::uint64_t> b(a.size() - 1);
+        for (std::size_t i = 1; i < a.size(); ++i)
+            b[i - 1] = mod_mul(a[i], i % xPrime, xPrime);
+
+        const auto tTrim = [](std::vector<std::uint64_t> &xValues)
+        {
+            while (!xValues.empty() && xValues.back() == 0)
+                xValues.pop_back();
+        };
+        tTrim(b);
+        while (!b.empty())
+        {
+            const std::uint64_t tInverse = mod_inverse(b.back(), xPrime);
+            while (a.size() >= b.size())
+            {
+                const std::uint64_t tFactor = mod_mul(a.back(), tInverse, xPrime);
+                const std::size_t tShift = a.size() - b.size();
+                for (std::size_t i = 0; i < b.size(); ++i)
+                    a[i + tShift] = mod_sub(a[i + tShift], mod_mul(tFactor, b[i], xPrime), xPrime);
+                tTrim(a);
+            }
+            std::swap(a, b);
+        }
+        return a.size() == 1;
+    }
+
+    /**
+     * @brief Returns a / b where b is primitive and divides a.
+     */
+    template <typename Int>
+    [[nodiscard]] Polynomial<Int> poly_exact_divide(Polynomial<Int> a, const Polynomial<Int> &b)
+    {
+        Polynomial<Int> tQuotient(a.size() - b.size() + 1, Int(0));
+        for (std::size_t k = tQuotient.size(); k-- > 0;)
+        {
+            tQuotient[k] = a[k + b.size() - 1] / b.back();
+            for (std::size_t i = 0; i < b.size(); ++i)
+                a[i + k] = checked_add(a[i + k], -checked_mul(tQuotient[k], b[i]));
+        }
+        return tQuotient;
+    }
+
+    /**
+     * @brief Replaces p(x) by p(x + xShift) with the O(n^2) Horner scheme.
+     */
+    template <typename Int>
+    void poly_taylor_shift(Polynomial<Int> &xPoly, const Int &xShift)
+    {
+        const std::size_t n = xPoly.size() - 1;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (std::size_t j = n; j-- > i;)
+                xPoly[j] = checked_add(xPoly[j], xShift == Int(1) ? xPoly[j + 1] : checked_mul(xShift, xPoly[j + 1]));
+        }
+    }
+
+    template <typename Int>
+    [[nodiscard]] std::size_t sign_variations(const Polynomial<Int> &xPoly) noexcept
+    {
+        std::size_t tCount = 0;
+        int tLast = 0;
+        for (const auto &tCoefficient : xPoly)
+        {
+            const int tSign = (Int(0) < tCoefficient) - (tCoefficient < Int(0));
+            if (tSign != 0 && tLast != 0 && tSign != tLast)
+                ++tCount;
+            if (tSign != 0)
+                tLast = tSign;
+        }
+        return tCount;
+    }
+
+    /**
+     * @brief Returns e such that every positive root of xPoly (in coefficient order xBegin..xEnd) is at most 2^e.
+     *
+     * Kioustelidis' bound 2 * max (|a_i| / a_n)^(1 / (n - i)) over the coefficients of opposite sign to
+     * the leading one, rounded up to a power of two from bit lengths only.
+     *
+     * @return INT_MIN if there is no positive root.
+     */
+    template <typename Int, typename Iterator>
+    [[nodiscard]] int positive_root_bound(Iterator xBegin, Iterator xEnd)
+    {
+        const auto n = static_cast<int>(std::distance(xBegin, xEnd)) - 1;
+        const Int &tLead = *(xBegin + n);
+        const int tLeadBits = bit_length(tLead);
+        int tBest = INT_MIN;
+        for (int i = 0; i < n; ++i)
+        {
+            const Int &tCoefficient = *(xBegin + i);
+            if (tCoefficient == Int(0) || (tCoefficient < Int(0)) == (tLead < Int(0)))
+                continue;
+            const int tNumerator = bit_length(tCoefficient) - tLeadBits + 1;
+            const int tDegree = n - i;
+            const int tExponent = tNumerator >= 0 ? (tNumerator + tDegree - 1) / tDegree : -((-tNumerator) / tDegree);
+            tBest = std::max(tBest, tExponent + 1);
+        }
+        return tBest;
+    }
+
+    /**
+     * @brief Subproblem of the continued fraction isolation: the positive roots of xPoly map to the roots
+     * of the input polynomial by the Moebius transformation x -> (a x + b) / (c x + d).
+     */
+    template <typename Int>
+    struct RootTask
+    {
+        Polynomial<Int> poly;
+        Int a, b, c, d;
+    };
+
+    /// Root interval in the working integer type, lower = ln / ld, upper = un / ud.
+    template <typename Int>
+    struct RawInterval
+    {
+        Int ln, ld, un, ud;
+    };
+
+    /**
+     * @brief Processes one subproblem of the Vincent-Collins-Akritas continued fraction method.
+     *
+     * Records the roots it can decide and appends the two subproblems x -> x + 1 and x -> 1 / (x + 1)
+     * otherwise. Before splitting, the polynomial is shifted by a lower bound of its positive roots, so
+     * large roots are reached in few steps.
+     */
+    template <typename Int, typename Container>
+    void isolate_step(RootTask<Int> xTask, std::vector<RawInterval<Int>> &xRoots, Container &xPending)
+    {
+        auto &[p, a, b, c, d] = xTask;
+
+        while (true)
+        {
+            // A root at 0 is the rational root b / d.
+            if (p.front() == Int(0))
+            {
+                xRoots.push_back({b, d, b, d});
+                p.erase(p.begin());
+            }
+
+            const std::size_t tVariations = sign_variations(p);
+            if (tVariations == 0)
+                return;
+            if (tVariations == 1)
+            {
+                if (c != Int(0))
+                {
+                    xRoots.push_back({b, d, a, c});
+                }
+                else
+                {
+                    // M(inf) is infinite, bound the interval by M(2^e) instead.
+                    const int tExponent = std::max(0, positive_root_bound<Int>(p.begin(), p.end()));
+                    Int tBound{1};
+                    for (int i = 0; i < tExponent; ++i)
+                        tBound = checked_add(tBound, tBound);
+                    xRoots.push_back({b, d, checked_add(checked_mul(a, tBound), b), d});
+                }
+                return;
+            }
+
+            // The positive roots of x^n p(1/x) are the reciprocals of those of p.
+            const int tLower = positive_root_bound<Int>(p.rbegin(), p.rend());
+            if (tLower > 0)
+                break;
+            Int tShift{1};
+            for (int i = 0; i < -tLower; ++i)
+                tShift = checked_add(tShift, tShift);
+            poly_taylor_shift(p, tShift);
+            b = checked_add(b, checked_mul(a, tShift));
+            d = checked_add(d, checked_mul(c, tShift));
+        }
+
+        // Take out a root at 1, it would otherwise show up in both halves.
+        Int tSum{0};
+        for (const auto &tCoefficient : p)
+            tSum = checked_add(tSum, tCoefficient);
+        if (tSum == Int(0))
+        {
+            xRoots.push_back({checked_add(a, b), checked_add(c, d), checked_add(a, b), checked_add(c, d)});
+            Polynomial<Int> tQuotient(p.size() - 1);
+            tQuotient.back() = p.back();
+            for (std::size_t k = tQuotient.size() - 1; k-- > 0;)
+                tQuotient[k] = checked_add(p[k + 1], tQuotient[k + 1]);
+            p = std::move(tQuotient);
+        }
+        poly_primitive(p);
+
+        // (0, 1) via x -> 1 / (x + 1).
+        RootTask<Int> tLeft{Polynomial<Int>(p.rbegin(), p.rend()), b, checked_add(a, b), d, checked_add(c, d)};
+        poly_taylor_shift(tLeft.poly, Int(1));
+        // (1, inf) via x -> x + 1.
+        poly_taylor_shift(p, Int(1));
+        xPending.push_back(RootTask<Int>{std::move(p), a, checked_add(a, b), c, checked_add(c, d)});
+        xPending.push_back(std::move(tLeft));
+    }
+
+    template <MathType Type, typename Int>
+    [[nodiscard]] Type narrow_root(const Int &xValue) noexcept(false)
+    {
+        if constexpr (!std::is_same_v<Type, Int>)
+        {
+            if (xValue > static_cast<Int>(std::numeric_limits<Type>::max()) || xValue < static_cast<Int>(std::numeric_limits<Type>::lowest()))
+                throw std::overflow_error("Root interval does not fit into the fraction's value type.");
+        }
+        return static_cast<Type>(xValue);
+    }
+}
+
+/**
+ * @brief Isolates all real roots of an integer polynomial with the continued fraction (Vincent-Collins-Akritas) method.
+ *
+ * The polynomial is first made square-free. Positive and negative roots are isolated separately by
+ * Descartes' rule of signs on Taylor-shifted integer polynomials; no floating point is involved, so
+ * the result is exact. Independent subtrees of the subdivision run in parallel.
+ *
+ * With built-in value types all coefficients are computed in WideProduct_t<Type>; if they outgrow it
+ * std::overflow_error is thrown instead of returning a wrong result.
+ *
+ * @param xCoefficients The coefficients, xCoefficients[i] belongs to x^i.
+ * @param xOptions Thread count and parallel cut-off.
+ * @return One interval per distinct real root, sorted ascending.
+ * @exception std::invalid_argument - If the polynomial is zero.
+ * @exception std::overflow_error - If an intermediate coefficient or an endpoint does not fit.
+ */
+template <MathType Type>
+    requires(!std::is_unsigned_v<Type>)
+[[nodiscard]] std::vector<RootInterval<Type>> isolate_real_roots(std::span<const Type> xCoefficients, const RootIsolationOptions &xOptions = {}) noexcept(false)
+{
+    using Int = WideProduct_t<Type>;
+    using namespace fraction_detail;
+
+    Polynomial<Int> tPoly(xCoefficients.begin(), xCoefficients.end());
+    poly_trim(tPoly);
+    if (tPoly.empty())
+        throw std::invalid_argument("The zero polynomial has no isolated roots.");
+
+    std::vector<RawInterval<Int>> tRoots;
+    std::size_t tZeros = 0;
+    while (tPoly[tZeros] == Int(0))
+        ++tZeros;
+    if (tZeros > 0)
+    {
+        tRoots.push_back({Int(0), Int(1), Int(0), Int(1)});
+        tPoly.erase(tPoly.begin(), tPoly.begin() + static_cast<std::ptrdiff_t>(tZeros));
+    }
+
+    if (tPoly.size() > 2)
+    {
+        poly_primitive(tPoly);
+        // The integer gcd grows its coefficients quickly, only run it if a modular test finds a repeated factor.
+        const auto tPrimes = word_primes(2);
+        if (!poly_squarefree_mod_p(tPoly, tPrimes[0]) && !poly_squarefree_mod_p(tPoly, tPrimes[1]))
+        {
+            Polynomial<Int> tDerivative(tPoly.size() - 1);
+            for (std::size_t i = 1; i < tPoly.size(); ++i)
+                tDerivative[i - 1] = checked_mul(tPoly[i], static_cast<Int>(i));
+            const auto tGCD = poly_gcd(tPoly, tDerivative);
+            if (tGCD.size() > 1)
+                tPoly = poly_exact_divide(tPoly, tGCD);
+        }
+    }
+
+    std::deque<RootTask<Int>> tQueue;
+    if (tPoly.size() > 1)
+    {
+        Polynomial<Int> tMirrored = tPoly;
+        for (std::size_t i = 1; i < tMirrored.size(); i += 2)
+            tMirrored[i] = -tMirrored[i];
+        tQueue.push_back({tPoly, Int(1), Int(0), Int(0), Int(1)});
+        // Roots of p(-x) are the negated roots, x -> -x is part of the transformation.
+        tQueue.push_back({std::move(tMirrored), Int(-1), Int(0), Int(0), Int(1)});
+    }
+
+    std::size_t tThreads = 1;
+    if (tPoly.size() > xOptions.parallelDegree)
+        tThreads = xOptions.threads == 0 ? std::max<std::size_t>(1, std::thread::hardware_concurrency()) : xOptions.threads;
+
+    // Expand breadth-first until there is one independent subtree per thread.
+    while (!tQueue.empty() && tQueue.size() < tThreads)
+    {
+        auto tTask = std::move(tQueue.front());
+        tQueue.pop_front();
+        isolate_step(std::move(tTask), tRoots, tQueue);
+    }
+
+    const std::vector<RootTask<Int>> tWork(std::make_move_iterator(tQueue.begin()), std::make_move_iterator(tQueue.end()));
+    const std::size_t tBlocks = std::max<std::size_t>(1, std::min(tThreads, tWork.size()));
+    std::vector<std::vector<RawInterval<Int>>> tLocal(tBlocks);
+    for_each_block(tBlocks,
+                   [&](std::size_t xBlock)
+                   {
+                       std::vector<RootTask<Int>> tStack;
+                       for (std::size_t i = xBlock; i < tWork.size(); i += tBlocks)
+                           tStack.push_back(tWork[i]);
+                       while (!tStack.empty())
+                       {
+                           auto tTask = std::move(tStack.back());
+                           tStack.pop_back();
+                           isolate_step(std::move(tTask), tLocal[xBlock], tStack);
+                       }
+                   });
+    for (const auto &tBlock : tLocal)
+        tRoots.insert(tRoots.end(), tBlock.begin(), tBlock.end());
+
+    std::vector<RootInterval<Type>> tResult;
+    tResult.reserve(tRoots.size());
+    for (const auto &[ln, ld, un, ud] : tRoots)
+    {
+        // Denominators of the transformation are never negative, the sign sits in the numerators.
+        Fraction<Type> tFirst{narrow_root<Type>(ln), narrow_root<Type>(ld)};
+        Fraction<Type> tSecond{narrow_root<Type>(un), narrow_root<Type>(ud)};
+        if (cross_compare(tFirst.getNumerator(), tFirst.getDenominator(), tSecond.getNumerator(), tSecond.getDenominator()) > 0)
+            std::swap(tFirst, tSecond);
+        tResult.push_back({tFirst, tSecond});
+    }
+    std::sort(tResult.begin(), tResult.end(),
+              [](const RootInterval<Type> &x, const RootInterval<Type> &y)
+              { return cross_compare(x.lower.getNumerator(), x.lower.getDenominator(), y.lower.getNumerator(), y.lower.getDenominator()) < 0; });
+    return tResult;
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionAlgorithm.h"
+#include "FractionChecked.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Term n of a hypergeometric-type series as consumed by binary_splitting_sum().
+ *
+ * The series is S = sum_n a(n) / b(n) * (p(first) * ... * p(n)) / (q(first) * ... * q(n)).
+ */
+template <MathType Type>
+struct SeriesTerm
+{
+    Type a;
+    Type b;
+    Type p;
+    Type q;
+};
+
+namespace fraction_detail
+{
+    /**
+     * @brief Partial products of the range [first, last): P = prod p, Q = prod q, B = prod b and
+     * T such that the partial sum equals T / (B * Q).
+     */
+    template <MathType Type>
+    struct SplitState
+    {
+        Type P;
+        Type Q;
+        Type B;
+        Type T;
+    };
+
+    /**
+     * @brief Appends the right range to the left one.
+     * @exception std::overflow_error - If a product or the sum overflows a built-in Type.
+     */
+    template <MathType Type>
+    [[nodiscard]] SplitState<Type> split_merge(const SplitState<Type> &xLeft, const SplitState<Type> &xRight) noexcept(false)
+    {
+        return {checked_mul(xLeft.P, xRight.P), checked_mul(xLeft.Q, xRight.Q), checked_mul(xLeft.B, xRight.B),
+                checked_add(checked_mul(checked_mul(xRight.B, xRight.Q), xLeft.T), checked_mul(checked_mul(xLeft.B, xLeft.P), xRight.T))};
+    }
+
+    template <MathType Type, typename Term>
+    [[nodiscard]] SplitState<Type> split_range(std::size_t xFirst, std::size_t xLast, const Term &xTerm)
+    {
+        if (xLast - xFirst == 1)
+        {
+            const SeriesTerm<Type> tTerm = xTerm(xFirst);
+            return {tTerm.p, tTerm.q, tTerm.b, checked_mul(tTerm.a, tTerm.p)};
+        }
+        const std::size_t tMiddle = xFirst + (xLast - xFirst) / 2;
+        return split_merge(split_range<Type>(xFirst, tMiddle, xTerm), split_range<Type>(tMiddle, xLast, xTerm));
+    }
+}
+
+/**
+ * @brief Sums the terms [xFirst, xLast) of a hypergeometric-type series by binary splitting.
+ *
+ * The range is halved recursively and both halves are combined with four products, so the operands
+ * of every multiplication have about the same size. With a bignum Type this costs O(M(n log n) log n)
+ * instead of the O(n^2) of adding term by term with operator+=. Ranges above the sequential cut-off
+ * are split into one block per thread first; the block results are merged in order.
+ *
+ * With built-in value types the products of the whole range have to fit into Type; every product
+ * and sum is overflow-checked for them.
+ *
+ * @param xFirst The first term index.
+ * @param xLast One past the last term index.
+ * @param xTerm Callable std::size_t -> SeriesTerm<Type>, b(n) and q(n) must be unequal zero.
+ * @param xOptions Thread count and sequential cut-off.
+ * @return The simplified partial sum, 0 for an empty range.
+ * @exception std::overflow_error - If an intermediate product or sum overflows a built-in Type.
+ */
+template <MathType Type, typename Term>
+[[nodiscard]] Fraction<Type> binary_splitting_sum(std::size_t xFirst, std::size_t xLast, const Term &xTerm, const FractionParallelOptions &xOptions = {})
+{
+    if (xLast <= xFirst)
+        return Fraction<Type>{Type(0), Type(1)};
+
+    const std::size_t tSize = xLast - xFirst;
+    const std::size_t tBlocks = fraction_detail::block_count(tSize, xOptions);
+    const std::size_t tBlockSize = (tSize + tBlocks - 1) / tBlocks;
+    std::vector<fraction_detail::SplitState<Type>> tStates(tBlocks, {Type(1), Type(1), Type(1), Type(0)});
+    fraction_detail::for_each_block(tBlocks,
+                                    [&](std::size_t b)
+                                    {
+                                        const std::size_t tBegin = xFirst + std::min(tSize, b * tBlockSize);
+                                        const std::size_t tEnd = xFirst + std::min(tSize, (b + 1) * tBlockSize);
+                                        if (tBegin < tEnd)
+                                            tStates[b] = fraction_detail::split_range<Type>(tBegin, tEnd, xTerm);
+                                    });
+
+    auto tResult = tStates.front();
+    for (std::size_t b = 1; b < tBlocks; ++b)
+        tResult = fraction_detail::split_merge(tResult, tStates[b]);
+    return Fraction<Type>{tResult.T, fraction_detail::checked_mul(tResult.B, tResult.Q)}.simplify();
+}
+
+/**
+ * @brief Calculates the harmonic number H_n = 1 + 1/2 + ... + 1/n.
+ * @exception std::overflow_error - If n! does not fit into a built-in Type, i.e. n > 20 for std::int64_t.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> harmonic_number(std::size_t n, const FractionParallelOptions &xOptions = {})
+{
+    return binary_splitting_sum<Type>(1, n + 1, [](std::size_t k) { return SeriesTerm<Type>{Type(1), static_cast<Type>(k), Type(1), Type(1)}; },
+                                      xOptions);
+}
+
+/**
+ * @brief Calculates the partial sum 1/0! + 1/1! + ... + 1/(xTerms - 1)! of e.
+ * @exception std::overflow_error - If an intermediate overflows a built-in Type.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> e_partial_sum(std::size_t xTerms, const FractionParallelOptions &xOptions = {})
+{
+    return binary_splitting_sum<Type>(0, xTerms, [](std::size_t k) { return SeriesTerm<Type>{Type(1), Type(1), Type(1), static_cast<Type>(k == 0 ? 1 : k)}; },
+                                      xOptions);
+}
+
+/**
+ * @brief Calculates the partial sum of arctan(1 / xInverse) with xTerms terms of its Taylor series.
+ * @exception std::overflow_error - If an intermediate overflows a built-in Type.
+ */
+template <MathType Type>
+[[nodiscard]] Fraction<Type> arctan_inverse_partial_sum(const Type &xInverse, std::size_t xTerms, const FractionParallelOptions &xOptions = {})
+{
+    const Type tSquare = fraction_detail::checked_mul(xInverse, xInverse);
+    return binary_splitting_sum<Type>(
+        0, xTerms,
+        [&xInverse, &tSquare](std::size_t k)
+        { return SeriesTerm<Type>{Type(1), static_cast<Type>(2 * k + 1), k == 0 ? Type(1) : Type(-1), k == 0 ? xInverse : tSquare}; },
+        xOptions);
+}
+
+/**
+ * @brief Approximates pi with Machin's formula 16 arctan(1/5) - 4 arctan(1/239), xTerms terms per arctan.
+ * @exception std::overflow_error - If an intermediate overflows a built-in Type.
+ */
+template <MathType Type>
+    requires(!std::is_unsigned_v<Type>)
+[[nodiscard]] Fraction<Type> pi_partial_sum(std::size_t xTerms, const FractionParallelOptions &xOptions = {})
+{
+    using fraction_detail::checked_add;
+    using fraction_detail::checked_mul;
+
+    const auto tFirst = arctan_inverse_partial_sum<Type>(Type(5), xTerms, xOptions);
+    const auto tSecond = arctan_inverse_partial_sum<Type>(Type(239), xTerms, xOptions);
+    // 16 n1 / d1 - 4 n2 / d2 over the LCM of the denominators.
+    const Type tGCD = fraction_GCD(tFirst.getDenominator(), tSecond.getDenominator());
+    const Type tFirstScale = tSecond.getDenominator() / tGCD;
+    const Type tSecondScale = tFirst.getDenominator() / tGCD;
+    const Type tNumerator = checked_add(checked_mul(checked_mul(Type(16), tFirst.getNumerator()), tFirstScale),
+                                        checked_mul(checked_mul(Type(-4), tSecond.getNumerator()), tSecondScale));
+    return Fraction<Type>{tNumerator, checked_mul(tFirst.getDenominator(), tFirstScale)}.simplify();
+}
+
+/**
+ * @brief Calculates the Bernoulli number B_n with B_1 = -1/2.
+ *
+ * Uses B_n = sum_k (-1)^k k! S(n, k) / (k + 1) with the Stirling numbers of the second kind S(n, k).
+ * The numerators are integers from one O(n^2) recurrence, the sum over k runs through
+ * binary_splitting_sum().
+ *
+ * @exception std::overflow_error - If an intermediate overflows a built-in Type; the sum scales
+ * k! S(n, k) by (n + 1)!, so std::int64_t reaches n = 12.
+ */
+template <MathType Type>
+    requires(!std::is_unsigned_v<Type>)
+[[nodiscard]] Fraction<Type> bernoulli_number(std::size_t n, const FractionParallelOptions &xOptions = {})
+{
+    // Row n of the Stirling numbers of the second kind, S(m, k) = k S(m - 1, k) + S(m - 1, k - 1).
+    std::vector<Type> tStirling(n + 1, Type(0));
+    tStirling[0] = Type(1);
+    for (std::size_t m = 1; m <= n; ++m)
+    {
+        for (std::size_t k = m; k > 0; --k)
+            tStirling[k] = fraction_detail::checked_add(fraction_detail::checked_mul(static_cast<Type>(k), tStirling[k]), tStirling[k - 1]);
+        tStirling[0] = Type(0);
+    }
+
+    std::vector<Type> tNumerators(n + 1);
+    Type tFactorial{1};
+    for (std::size_t k = 0; k <= n; ++k)
+    {
+        if (k > 0)
+            tFactorial = fraction_detail::checked_mul(tFactorial, static_cast<Type>(k));
+        tNumerators[k] = fraction_detail::checked_mul(k % 2 == 0 ? tFactorial : -tFactorial, tStirling[k]);
+    }
+
+    return binary_splitting_sum<Type>(
+        0, n + 1, [&tNumerators](std::size_t k) { return SeriesTerm<Type>{tNumerators[k], static_cast<Type>(k + 1), Type(1), Type(1)}; }, xOptions);
+}
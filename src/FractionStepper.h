@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Fraction.h"
+#include "FractionColumn.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Walks the sequence x_k = x_0 + k * step with one addition and one comparison per step.
+ *
+ * The position is kept as whole + remainder / denominator with 0 <= remainder < denominator and a
+ * denominator fixed at construction (the LCM of both input denominators). Stepping is the Bresenham
+ * update of whole part and remainder, with none of the LCM work a repeated operator+= does. Typical
+ * uses are resampling (step = 44100/48000) and timeline scheduling.
+ */
+template <IntegralMathType Type>
+class FractionStepper
+{
+    Type mWhole{0};         ///< floor(x_k).
+    Type mRemainder{0};     ///< (x_k - floor(x_k)) * mDenominator.
+    Type mDenominator{1};   ///< Positive common denominator.
+    Type mStepWhole{0};     ///< floor(step).
+    Type mStepRemainder{0}; ///< (step - floor(step)) * mDenominator.
+
+    /**
+     * @brief Splits xNumerator / mDenominator into floor and non-negative remainder.
+     */
+    constexpr void floorSplit(const Type &xNumerator, Type &xWhole, Type &xRemainder) const noexcept
+    {
+        xWhole = xNumerator / mDenominator;
+        xRemainder = xNumerator % mDenominator;
+        if constexpr (!std::is_unsigned_v<Type>)
+        {
+            if (xRemainder < Type(0))
+            {
+                xRemainder = xRemainder + mDenominator;
+                xWhole = xWhole - Type(1);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the numerator of xValue over mDenominator.
+     */
+    [[nodiscard]] constexpr Type scaled(const Fraction<Type> &xValue) const noexcept
+    {
+        return xValue.getNumerator() * (mDenominator / xValue.getDenominator());
+    }
+
+public:
+    /**
+     * @brief Starts the sequence at xStart with the increment xStep.
+     */
+    constexpr FractionStepper(const Fraction<Type> &xStart, const Fraction<Type> &xStep) noexcept
+    {
+        const Type tStart = gcd_abs(xStart.getDenominator());
+        const Type tStep = gcd_abs(xStep.getDenominator());
+        mDenominator = tStart / fraction_GCD(tStart, tStep) * tStep;
+        floorSplit(scaled(xStart), mWhole, mRemainder);
+        floorSplit(scaled(xStep), mStepWhole, mStepRemainder);
+    }
+
+    [[nodiscard]] constexpr const Type &whole() const noexcept
+    {
+        return mWhole;
+    }
+
+    [[nodiscard]] constexpr const Type &remainder() const noexcept
+    {
+        return mRemainder;
+    }
+
+    [[nodiscard]] constexpr const Type &denominator() const noexcept
+    {
+        return mDenominator;
+    }
+
+    [[nodiscard]] constexpr const Type &stepWhole() const noexcept
+    {
+        return mStepWhole;
+    }
+
+    [[nodiscard]] constexpr const Type &stepRemainder() const noexcept
+    {
+        return mStepRemainder;
+    }
+
+    /**
+     * @brief Returns the current position as simplified fraction.
+     */
+    [[nodiscard]] constexpr Fraction<Type> value() const
+    {
+        return Fraction<Type>{mWhole * mDenominator + mRemainder, mDenominator}.simplify();
+    }
+
+    /**
+     * @brief Moves to the next element of the sequence.
+     */
+    constexpr FractionStepper &operator++() noexcept
+    {
+        // Compare against denominator - step instead of adding first, so remainder + step cannot overflow.
+        const Type tGap = mDenominator - mStepRemainder;
+        if (mRemainder >= tGap)
+        {
+            mRemainder = mRemainder - tGap;
+            mWhole = mWhole + mStepWhole + Type(1);
+        }
+        else
+        {
+            mRemainder = mRemainder + mStepRemainder;
+            mWhole = mWhole + mStepWhole;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Jumps xCount elements ahead with one division.
+     */
+    constexpr FractionStepper &advance(const Type &xCount) noexcept
+    {
+        using Wide_t = WideProduct_t<Type>;
+        const Wide_t tRemainder = static_cast<Wide_t>(mRemainder) + static_cast<Wide_t>(xCount) * static_cast<Wide_t>(mStepRemainder);
+        mWhole = mWhole + xCount * mStepWhole + static_cast<Type>(tRemainder / static_cast<Wide_t>(mDenominator));
+        mRemainder = static_cast<Type>(tRemainder % static_cast<Wide_t>(mDenominator));
+        return *this;
+    }
+};
+
+/**
+ * @brief Writes the next xWholes.size() positions of xStepper as whole part and remainder over xStepper.denominator().
+ *
+ * The first kLanes positions are computed with advance(), every further one from the output kLanes
+ * positions before it by one lane step of kLanes steps. The carry is branch-free and the loop only
+ * depends on outputs kLanes back, so the compiler vectorizes it (at -O3 with GCC).
+ *
+ * @param xStepper Position of the first output, it is not modified.
+ * @exception std::invalid_argument - If the output spans have different sizes.
+ */
+template <IntegralMathType Type>
+void step_range(const FractionStepper<Type> &xStepper, std::span<Type> xWholes, std::span<Type> xRemainders) noexcept(false)
+{
+    if (xWholes.size() != xRemainders.size())
+        throw std::invalid_argument("Wholes and remainders must have the same size.");
+
+    constexpr std::size_t kLanes = 8;
+    const std::size_t tHead = std::min(kLanes, xWholes.size());
+    for (std::size_t j = 0; j < tHead; ++j)
+    {
+        auto tLane = xStepper;
+        tLane.advance(static_cast<Type>(j));
+        xWholes[j] = tLane.whole();
+        xRemainders[j] = tLane.remainder();
+    }
+
+    // Step of one lane: kLanes * step.
+    using Wide_t = WideProduct_t<Type>;
+    const Type &tDenominator = xStepper.denominator();
+    const Wide_t tLaneRemainder = static_cast<Wide_t>(kLanes) * static_cast<Wide_t>(xStepper.stepRemainder());
+    const Type tStepWhole = static_cast<Type>(kLanes) * xStepper.stepWhole() + static_cast<Type>(tLaneRemainder / static_cast<Wide_t>(tDenominator));
+    const Type tStepRemainder = static_cast<Type>(tLaneRemainder % static_cast<Wide_t>(tDenominator));
+    const Type tGap = tDenominator - tStepRemainder;
+
+    // Every position is the one kLanes before it advanced by one lane step; the dependence distance of
+    // kLanes leaves the loop free to process kLanes positions per iteration.
+    Type *tWholes = xWholes.data();
+    Type *tRemainders = xRemainders.data();
+    for (std::size_t i = kLanes; i < xWholes.size(); ++i)
+    {
+        const Type tPrevious = tRemainders[i - kLanes];
+        const bool tCarry = tPrevious >= tGap;
+        tRemainders[i] = tCarry ? tPrevious - tGap : tPrevious + tStepRemainder;
+        tWholes[i] = tWholes[i - kLanes] + tStepWhole + static_cast<Type>(tCarry);
+    }
+}
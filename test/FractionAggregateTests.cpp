@@ -0,0 +1,119 @@
+#include "FractionAggregate.h"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct FractionAggregateTest : public testing::Test
+{
+};
+
+TEST_F(FractionAggregateTest, ExactSum)
+{
+    ExactSum<int64_t> tSum;
+    tSum.add(Fraction<int64_t>{1, 3});
+    tSum.add(Fraction<int64_t>{1, 6});
+    tSum.add(Fraction<int64_t>{1, -2});
+    tSum.add(Fraction<int64_t>{5, 4});
+
+    EXPECT_EQ(tSum.count(), 4u);
+    EXPECT_EQ(tSum.sum(), Fraction<int64_t>(5, 4));
+    EXPECT_EQ(tSum.mean(), Fraction<int64_t>(5, 16));
+
+    ExactSum<int64_t> tOther;
+    tOther.add(Fraction<int64_t>{3, 4});
+    tSum.merge(tOther);
+    EXPECT_EQ(tSum.sum(), Fraction<int64_t>(2, 1));
+
+    EXPECT_THROW(auto tTemp = ExactSum<int64_t>{}.mean(), std::invalid_argument);
+
+    // The cancelled prime denominators are reduced away once the running denominator would overflow __int128.
+    ExactSum<int64_t> tCancel;
+    for (const int64_t tPrime : {1099511627689, 1099511626771, 1099511625767, 1099511624677, 1099511623759})
+    {
+        tCancel.add(Fraction<int64_t>{1, tPrime});
+        tCancel.add(Fraction<int64_t>{tPrime - 1, tPrime});
+    }
+    EXPECT_EQ(tCancel.sum(), Fraction<int64_t>(5, 1));
+    EXPECT_EQ(tCancel.mean(), Fraction<int64_t>(1, 2));
+
+    // Three coprime denominators near 2^61 need about 183 bits; this is reported instead of wrapping around.
+    constexpr int64_t kMersenne = (int64_t(1) << 61) - 1;
+    constexpr int64_t kPrime62 = 4611686018427387847;
+    ExactSum<int64_t> tWide;
+    tWide.add(Fraction<int64_t>{1, kMersenne});
+    tWide.add(Fraction<int64_t>{1, kPrime62});
+    EXPECT_THROW(tWide.add(Fraction<int64_t>{1, 1152921504606846883}), std::overflow_error);
+    tWide.add(Fraction<int64_t>{-1, kPrime62});
+    EXPECT_EQ(tWide.sum(), Fraction<int64_t>(1, kMersenne));
+
+    // Products of large coprime 32-bit primes: the running denominator needs up to 124 bits and is
+    // reduced with 128-bit GCDs before the result fits into int64_t again.
+    constexpr int64_t p1 = 2147483647, p2 = 2147483629, p3 = 2147483587, p4 = 2147483579, p5 = 2147483563, p6 = 2147483549;
+    const std::pair<int64_t, int64_t> tTerms[] = {{27, p6 * p3}, {71, p5 * p4}, {-71, p5 * p4}, {3, p1 * p2}, {-3, p1 * p2}};
+    ExactSum<int64_t> tProducts;
+    for (const auto &tTerm : tTerms)
+        tProducts.add(Fraction<int64_t>{tTerm.first, tTerm.second});
+    EXPECT_EQ(tProducts.sum(), Fraction<int64_t>(27, p6 * p3));
+    EXPECT_THROW(auto tTemp = tProducts.mean(), std::overflow_error);
+}
+
+TEST_F(FractionAggregateTest, HashAggregator)
+{
+    HashAggregator<std::string, int> tAggregator;
+    tAggregator.add("a", Fraction(1, 2));
+    tAggregator.add("b", Fraction(1, 3));
+    tAggregator.add("a", Fraction(1, 4));
+
+    ASSERT_NE(tAggregator.find("a"), nullptr);
+    EXPECT_EQ(tAggregator.find("a")->sum(), Fraction(3, 4));
+    EXPECT_EQ(tAggregator.find("c"), nullptr);
+
+    HashAggregator<std::string, int> tOther;
+    tOther.add("b", Fraction(2, 3));
+    tAggregator.merge(tOther);
+
+    const auto tRows = tAggregator.finish();
+    ASSERT_EQ(tRows.size(), 2u);
+    for (const auto &tRow : tRows)
+    {
+        if (tRow.key == "b")
+        {
+            EXPECT_EQ(tRow.sum, Fraction(1, 1));
+            EXPECT_EQ(tRow.mean, Fraction(1, 2));
+            EXPECT_EQ(tRow.count, 2u);
+        }
+    }
+
+    EXPECT_THROW(tAggregator.merge(HashAggregator<std::string, int>{3}), std::invalid_argument);
+}
+
+TEST_F(FractionAggregateTest, ParallelMatchesSequential)
+{
+    std::mt19937 tGen{4};
+    std::uniform_int_distribution<int> tKey{0, 99};
+    std::uniform_int_distribution<int64_t> tNum{-1000, 1000};
+    const int64_t tDenominators[] = {1, 2, 4, 5, 10, 20, 25, 100};
+
+    std::vector<int> tKeys;
+    FractionColumn<int64_t> tValues;
+    std::map<int, Fraction<int64_t>> tExpected;
+    for (std::size_t i = 0; i < 20'000; ++i)
+    {
+        const Fraction<int64_t> tValue{tNum(tGen), tDenominators[i % 8]};
+        tKeys.push_back(tKey(tGen));
+        tValues.push_back(tValue);
+        auto [tIt, tInserted] = tExpected.try_emplace(tKeys.back(), Fraction<int64_t>{0, 1});
+        tIt->second += tValue;
+        tIt->second.simplify();
+    }
+
+    const auto tAggregator = aggregate_parallel(std::span<const int>{tKeys}, tValues, {.threads = 4, .sequentialCutoff = 0});
+    const auto tRows = tAggregator.finish();
+    EXPECT_EQ(tRows.size(), tExpected.size());
+    for (const auto &tRow : tRows)
+        EXPECT_EQ(tRow.sum, tExpected.at(tRow.key)) << tRow.key;
+}
@@ -0,0 +1,72 @@
+#include "FractionAlgorithm.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+struct FractionAlgorithmTest : public testing::Test
+{
+};
+
+TEST_F(FractionAlgorithmTest, InclusiveScan)
+{
+    const std::vector<Fraction<int64_t>> tIn{Fraction<int64_t>{1, 2}, Fraction<int64_t>{1, 3}, Fraction<int64_t>{-1, 6}, Fraction<int64_t>{2, -4}};
+    std::vector<Fraction<int64_t>> tOut(tIn.size());
+
+    inclusive_scan(std::span<const Fraction<int64_t>>{tIn}, std::span<Fraction<int64_t>>{tOut});
+    EXPECT_EQ(tOut[0], Fraction<int64_t>(1, 2));
+    EXPECT_EQ(tOut[1], Fraction<int64_t>(5, 6));
+    EXPECT_EQ(tOut[2], Fraction<int64_t>(2, 3));
+    EXPECT_EQ(tOut[3], Fraction<int64_t>(1, 6));
+
+    exclusive_scan(std::span<const Fraction<int64_t>>{tIn}, std::span<Fraction<int64_t>>{tOut}, Fraction<int64_t>{1});
+    EXPECT_EQ(tOut[0], Fraction<int64_t>(1, 1));
+    EXPECT_EQ(tOut[1], Fraction<int64_t>(3, 2));
+    EXPECT_EQ(tOut[2], Fraction<int64_t>(11, 6));
+    EXPECT_EQ(tOut[3], Fraction<int64_t>(5, 3));
+
+    std::vector<Fraction<int64_t>> tOutTooSmall(1);
+    EXPECT_THROW(inclusive_scan(std::span<const Fraction<int64_t>>{tIn}, std::span<Fraction<int64_t>>{tOutTooSmall}), std::invalid_argument);
+}
+
+TEST_F(FractionAlgorithmTest, ParallelScanMatchesSequential)
+{
+    std::mt19937 tGen{8};
+    std::uniform_int_distribution<int64_t> tNum{-100, 100};
+    const int64_t tDenominators[] = {1, 2, 3, 4, 5, 6, 8, 10, 12};
+
+    std::vector<Fraction<int64_t>> tIn;
+    for (int i = 0; i < 10'000; ++i)
+        tIn.emplace_back(tNum(tGen), tDenominators[static_cast<std::size_t>(i) % 9]);
+
+    std::vector<Fraction<int64_t>> tParallel(tIn.size());
+    inclusive_scan(std::span<const Fraction<int64_t>>{tIn}, std::span<Fraction<int64_t>>{tParallel}, {.threads = 4, .sequentialCutoff = 0});
+
+    Fraction<int64_t> tSum{0, 1};
+    for (std::size_t i = 0; i < tIn.size(); ++i)
+    {
+        tSum += tIn[i];
+        tSum.simplify();
+        ASSERT_EQ(tParallel[i], tSum) << i;
+    }
+
+    // In place.
+    inclusive_scan(std::span<const Fraction<int64_t>>{tIn}, std::span<Fraction<int64_t>>{tIn}, {.threads = 3, .sequentialCutoff = 0});
+    EXPECT_EQ(tIn, tParallel);
+}
+
+TEST_F(FractionAlgorithmTest, TreeSum)
+{
+    const std::vector<Fraction<int64_t>> tIn{Fraction<int64_t>{1, 2}, Fraction<int64_t>{1, -3}, Fraction<int64_t>{-1, 6}, Fraction<int64_t>{2, 4}};
+    EXPECT_EQ(tree_sum(std::span<const Fraction<int64_t>>{tIn}), Fraction<int64_t>(1, 2));
+    EXPECT_EQ(tree_sum(std::span<const Fraction<int64_t>>{tIn}.first(3)), Fraction<int64_t>(0, 1));
+    EXPECT_EQ(tree_sum(std::span<const Fraction<int64_t>>{}), Fraction<int64_t>(0, 1));
+
+    // Sum of 1 / (k (k + 1)) telescopes to 1 - 1 / (n + 1).
+    std::vector<Fraction<int64_t>> tTelescope;
+    for (int64_t k = 1; k <= 5000; ++k)
+        tTelescope.emplace_back(1, k * (k + 1));
+    const auto tSequential = tree_sum(std::span<const Fraction<int64_t>>{tTelescope});
+    EXPECT_EQ(tSequential, Fraction<int64_t>(5000, 5001));
+    EXPECT_EQ(tree_sum(std::span<const Fraction<int64_t>>{tTelescope}, FractionParallelOptions{4, 16}), tSequential);
+}
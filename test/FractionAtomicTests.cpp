@@ -0,0 +1,137 @@
+#include "FractionAtomic.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct FractionAtomicTest : public testing::Test
+{
+};
+
+TEST_F(FractionAtomicTest, LoadStoreCompareExchange)
+{
+    static_assert(AtomicFraction<int32_t>::is_lock_free());
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    // The build adds -mcx16 on x86-64, so 64-bit fractions use cmpxchg16b instead of the striped lock.
+    EXPECT_TRUE(AtomicFraction<int64_t>::is_lock_free());
+#endif
+
+    AtomicFraction<int64_t> tValue{Fraction<int64_t>(4, 8)};
+    EXPECT_EQ(tValue.load().getNumerator(), 1);
+    EXPECT_EQ(tValue.load().getDenominator(), 2);
+
+    Fraction<int64_t> tExpected{2, 4};
+    EXPECT_FALSE(tValue.compare_exchange(tExpected, Fraction<int64_t>(3, 1)));
+    EXPECT_EQ(tExpected.getNumerator(), 1);
+    EXPECT_TRUE(tValue.compare_exchange(tExpected, Fraction<int64_t>(3, 1)));
+    EXPECT_EQ(tValue.load(), Fraction<int64_t>(3, 1));
+
+    EXPECT_EQ(tValue.fetch_add(Fraction<int64_t>(1, 3)), Fraction<int64_t>(3, 1));
+    EXPECT_EQ(tValue.load(), Fraction<int64_t>(10, 3));
+    tValue.store(Fraction<int64_t>(-1, 7));
+    EXPECT_EQ(tValue.load(), Fraction<int64_t>(-1, 7));
+}
+
+TEST_F(FractionAtomicTest, ConcurrentAdds)
+{
+    constexpr int kThreads = 4;
+    constexpr int kAdds = 2000;
+    AtomicFraction<int32_t> tNarrow;
+    AtomicFraction<int64_t> tWide;
+    ShardedFractionSum<int64_t> tSharded{3};
+
+    std::vector<std::thread> tThreads;
+    for (int t = 0; t < kThreads; ++t)
+        tThreads.emplace_back(
+            [&, t]
+            {
+                for (int i = 0; i < kAdds; ++i)
+                {
+                    tNarrow += Fraction<int32_t>(1, 4);
+                    tWide += Fraction<int64_t>(1, 6);
+                    tSharded.add(Fraction<int64_t>(t + 1, 12));
+                }
+            });
+    for (auto &tThread : tThreads)
+        tThread.join();
+
+    EXPECT_EQ(tNarrow.load(), Fraction<int32_t>(kThreads * kAdds / 4, 1));
+    EXPECT_EQ(tWide.load(), Fraction<int64_t>(kThreads * kAdds / 2, 3));
+    EXPECT_EQ(tSharded.shards(), 3u);
+    EXPECT_EQ(tSharded.total(), Fraction<int64_t>((1 + 2 + 3 + 4) * kAdds / 4, 3));
+
+    // Shards over products of large 32-bit primes merge through 128-bit intermediates.
+    constexpr int64_t p3 = 2147483587, p4 = 2147483579, p5 = 2147483563, p6 = 2147483549;
+    const std::pair<int64_t, int64_t> tTerms[] = {{27, p6 * p3}, {71, p5 * p4}, {-71, p5 * p4}};
+    ShardedFractionSum<int64_t> tWideSum{4};
+    std::vector<std::thread> tWideThreads;
+    for (const auto &tTerm : tTerms)
+        tWideThreads.emplace_back([&tWideSum, tTerm] { tWideSum.add(Fraction<int64_t>{tTerm.first, tTerm.second}); });
+    for (auto &tThread : tWideThreads)
+        tThread.join();
+    EXPECT_EQ(tWideSum.total(), Fraction<int64_t>(27, p6 * p3));
+}
+
+TEST_F(FractionAtomicTest, ConcurrentTotal)
+{
+    constexpr int kThreads = 4;
+    constexpr int kAdds = 3000;
+    ConcurrentFractionTotal<int64_t> tTotal{{.shards = 2, .mergeInterval = std::chrono::milliseconds{1}}};
+    EXPECT_EQ(tTotal.shards(), 2u);
+    EXPECT_EQ(tTotal.snapshot(), Fraction<int64_t>(0, 1));
+
+    std::vector<std::thread> tThreads;
+    for (int t = 0; t < kThreads; ++t)
+        tThreads.emplace_back(
+            [&]
+            {
+                for (int i = 0; i < kAdds; ++i)
+                {
+                    tTotal += Fraction<int64_t>(1, 3);
+                    tTotal.add(Fraction<int64_t>(-1, 5));
+                }
+            });
+    for (auto &tThread : tThreads)
+        tThread.join();
+
+    // 4 * 3000 * (1/3 - 1/5) = 1600
+    EXPECT_EQ(tTotal.total(), Fraction<int64_t>(1600, 1));
+    EXPECT_EQ(tTotal.snapshot(), Fraction<int64_t>(1600, 1));
+
+    ConcurrentFractionTotal<int32_t> tManual{{.shards = 1, .mergeInterval = std::chrono::milliseconds{0}}};
+    tManual.add(Fraction<int32_t>(1, 2));
+    EXPECT_EQ(tManual.snapshot(), Fraction<int32_t>(0, 1));
+    EXPECT_EQ(tManual.total(), Fraction<int32_t>(1, 2));
+    EXPECT_EQ(tManual.snapshot(), Fraction<int32_t>(1, 2));
+
+    // 1/p1 + 1/p2 is exact in the int64_t accumulator but does not fit into int32_t.
+    constexpr int32_t p1 = 2147483647, p2 = 2147483629;
+    ConcurrentFractionTotal<int32_t> tFailing{{.shards = 1, .mergeInterval = std::chrono::milliseconds{0}}};
+    tFailing.add(Fraction<int32_t>(1, p1));
+    tFailing.add(Fraction<int32_t>(1, p2));
+    EXPECT_THROW(auto tTemp = tFailing.total(), std::overflow_error);
+    EXPECT_THROW(auto tTemp = tFailing.snapshot(), std::overflow_error);
+
+    // The same failure on the merge thread is rethrown by snapshot() instead of terminating.
+    ConcurrentFractionTotal<int32_t> tBackground{{.shards = 1, .mergeInterval = std::chrono::milliseconds{1}}};
+    tBackground.add(Fraction<int32_t>(1, p1));
+    tBackground.add(Fraction<int32_t>(1, p2));
+    bool tThrown = false;
+    for (int i = 0; i < 5000 && !tThrown; ++i)
+    {
+        try
+        {
+            auto tTemp = tBackground.snapshot();
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        catch (const std::overflow_error &)
+        {
+            tThrown = true;
+        }
+    }
+    EXPECT_TRUE(tThrown);
+    EXPECT_THROW(auto tTemp = tBackground.total(), std::overflow_error);
+}
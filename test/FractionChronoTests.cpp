@@ -0,0 +1,53 @@
+#include "FractionChrono.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+struct FractionChronoTest : public testing::Test
+{
+};
+
+TEST_F(FractionChronoTest, RatioAndDuration)
+{
+    constexpr auto tMilli = ratio_to_Fraction<std::milli>();
+    static_assert(tMilli.getNumerator() == 1 && tMilli.getDenominator() == 1000);
+    EXPECT_EQ((ratio_to_Fraction<std::ratio<6, -4>, int>()), Fraction<int>(-3, 2));
+
+    EXPECT_EQ(duration_to_Fraction<int64_t>(std::chrono::milliseconds{1500}), Fraction<int64_t>(3, 2));
+    EXPECT_EQ(duration_to_Fraction<int64_t>(std::chrono::minutes{2}), Fraction<int64_t>(120, 1));
+
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+    EXPECT_EQ(exact_duration_cast<milliseconds>(microseconds{-2500}).count(), -2);
+    EXPECT_EQ(exact_duration_cast<milliseconds>(microseconds{-2500}, RoundingMode::Floor).count(), -3);
+    EXPECT_EQ(exact_duration_cast<milliseconds>(microseconds{2500}, RoundingMode::HalfEven).count(), 2);
+    EXPECT_EQ(exact_duration_cast<milliseconds>(microseconds{3500}, RoundingMode::HalfEven).count(), 4);
+    EXPECT_EQ(exact_duration_cast<microseconds>(milliseconds{7}).count(), 7000);
+
+    // count * num overflows intmax_t in std::chrono::duration_cast, not here.
+    using Ticks = std::chrono::duration<int64_t, std::ratio<1, 3>>;
+    EXPECT_EQ(exact_duration_cast<Ticks>(std::chrono::nanoseconds{INT64_C(9000000000000000000)}).count(), INT64_C(27000000000));
+}
+
+TEST_F(FractionChronoTest, RuntimePeriod)
+{
+    // NTSC frame period 1001/30000 s.
+    FractionDuration<int64_t> tFrames{Fraction<int64_t>{1001, 30000}};
+    for (int i = 0; i < 30000; ++i)
+        ++tFrames;
+    EXPECT_EQ(tFrames.seconds(), Fraction<int64_t>(1001, 1));
+    EXPECT_EQ(tFrames.to_duration<std::chrono::milliseconds>().count(), 1001000);
+
+    tFrames += 1;
+    EXPECT_EQ(tFrames.to_duration<std::chrono::microseconds>().count(), 1001033366);
+    EXPECT_EQ(tFrames.to_duration<std::chrono::microseconds>(RoundingMode::Ceiling).count(), 1001033367);
+
+    const auto tFromChrono = FractionDuration<int64_t>::from(std::chrono::seconds{1001}, Fraction<int64_t>{2002, 60000});
+    EXPECT_EQ(tFromChrono.ticks(), 30000);
+    EXPECT_EQ(tFromChrono, (FractionDuration<int64_t>{Fraction<int64_t>{1, 1}, 1001}));
+    EXPECT_LT(tFromChrono, tFrames);
+
+    EXPECT_THROW(FractionDuration<int64_t>{Fraction<int64_t>(-1, 2)}, std::invalid_argument);
+}
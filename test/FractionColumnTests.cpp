@@ -0,0 +1,136 @@
+#include "FractionColumn.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+struct FractionColumnTest : public testing::Test
+{
+};
+
+TEST_F(FractionColumnTest, Construction)
+{
+    FractionColumn<int> tColumn{{1, 2, 3}, {2, 3, 4}};
+    EXPECT_EQ(tColumn.size(), 3u);
+    EXPECT_EQ(tColumn[1], Fraction(2, 3));
+
+    EXPECT_THROW(FractionColumn<int>({1, 2}, {1}), std::invalid_argument);
+    EXPECT_THROW(FractionColumn<int>({1, 2}, {1, 0}), std::invalid_argument);
+}
+
+TEST_F(FractionColumnTest, ScanCompare)
+{
+    std::mt19937 tGen{1};
+    std::uniform_int_distribution<int32_t> tNum{-1000, 1000};
+    std::uniform_int_distribution<int32_t> tDen{1, 50};
+
+    FractionColumn<int32_t> tColumn;
+    for (int i = 0; i < 1000; ++i)
+        tColumn.push_back(Fraction<int32_t>{tNum(tGen), tDen(tGen) * (i % 5 == 0 ? -1 : 1)});
+
+    const Fraction<int32_t> tConstant{3, 7};
+    const auto tGreater = scan_compare(tColumn, FractionCompare::Greater, tConstant);
+    const auto tLessEqual = scan_compare(tColumn, FractionCompare::LessEqual, tConstant);
+    ASSERT_EQ(tGreater.size(), 16u);
+
+    for (std::size_t i = 0; i < tColumn.size(); ++i)
+    {
+        const auto tValue = tColumn[i];
+        const bool tExpected = static_cast<long double>(tValue.getNumerator()) / tValue.getDenominator() > 3.0L / 7.0L;
+        EXPECT_EQ(((tGreater[i / 64] >> (i % 64)) & 1) != 0, tExpected) << i;
+        EXPECT_NE(((tGreater[i / 64] >> (i % 64)) & 1), ((tLessEqual[i / 64] >> (i % 64)) & 1)) << i;
+    }
+    EXPECT_EQ(count_matches(tGreater) + count_matches(tLessEqual), tColumn.size());
+
+    FractionColumn<int32_t> tEqual{{3, 6, -3, 4}, {7, 14, -7, 7}};
+    EXPECT_EQ(scan_compare(tEqual, FractionCompare::Equal, tConstant).front(), 0b0111u);
+    EXPECT_EQ(scan_compare(tEqual, FractionCompare::NotEqual, tConstant).front(), 0b1000u);
+}
+
+TEST_F(FractionColumnTest, ScanCompareWide)
+{
+    constexpr auto kMax = std::numeric_limits<int64_t>::max();
+    // Both differ from 1 by 1/kMax resp. 1/(kMax - 1), which no floating-point type can tell apart.
+    FractionColumn<int64_t> tColumn{{kMax - 1, kMax - 2}, {kMax, kMax - 1}};
+    const auto tMask = scan_compare(tColumn, FractionCompare::Less, Fraction<int64_t>{kMax - 1, kMax});
+    EXPECT_EQ(tMask.front(), 0b10u);
+}
+
+TEST_F(FractionColumnTest, Reductions)
+{
+    FractionColumn<int> tColumn{{1, -3, 5, 7, -3}, {2, 4, 3, -8, 4}};
+    EXPECT_EQ(column_argmin(tColumn), 3u);
+    EXPECT_EQ(column_argmax(tColumn), 2u);
+    EXPECT_EQ(column_min(tColumn), Fraction(7, -8));
+    EXPECT_EQ(column_max(tColumn), Fraction(5, 3));
+
+    EXPECT_THROW(auto tTemp = column_argmin(FractionColumn<int>{}), std::invalid_argument);
+}
+
+TEST_F(FractionColumnTest, Rounding)
+{
+    const FractionColumn<int32_t> tColumn{{-7, 7, 5, -9, 6}, {2, 2, -2, 4, 3}};
+    std::vector<int32_t> tOut(tColumn.size());
+
+    column_floor(tColumn, std::span{tOut});
+    EXPECT_EQ(tOut, (std::vector<int32_t>{-4, 3, -3, -3, 2}));
+    column_ceil(tColumn, std::span{tOut});
+    EXPECT_EQ(tOut, (std::vector<int32_t>{-3, 4, -2, -2, 2}));
+    column_trunc(tColumn, std::span{tOut});
+    EXPECT_EQ(tOut, (std::vector<int32_t>{-3, 3, -2, -2, 2}));
+    column_round(tColumn, std::span{tOut}, RoundingMode::HalfEven);
+    EXPECT_EQ(tOut, (std::vector<int32_t>{-4, 4, -2, -2, 2}));
+
+    for (std::size_t i = 0; i < tColumn.size(); ++i)
+        EXPECT_EQ(tOut[i], round(tColumn[i], RoundingMode::HalfEven)) << i;
+    EXPECT_THROW(column_floor(tColumn, std::span{tOut}.first(2)), std::invalid_argument);
+}
+
+TEST_F(FractionColumnTest, DoubleConversion)
+{
+    // Quotients where converting numerator and denominator first rounds twice.
+    const FractionColumn<int64_t> tColumn{{6402900570728149493, -1734979221052636100, 3609387305112233261, 1, 0},
+                                          {7435617913856420575, 1123636855310136380, 7431571719115430142, 3, -5}};
+    std::vector<double> tOut(tColumn.size());
+    column_to_double(tColumn, std::span{tOut});
+    EXPECT_EQ(tOut[0], 0.8611121019002628);
+    EXPECT_EQ(tOut[1], -1.544074682895447);
+    EXPECT_EQ(tOut[2], 0.48568290013648063);
+    EXPECT_EQ(tOut[3], 1.0 / 3.0);
+    EXPECT_TRUE(tOut[4] == 0.0 && std::signbit(tOut[4]));
+    EXPECT_THROW(column_to_double(tColumn, std::span{tOut}.first(2)), std::invalid_argument);
+
+    const std::vector<double> tValues{0.375, -6.0, 0.1, 1e-300, 0.0, 1.0 / 3.0};
+    const auto tExact = column_from_double<int64_t>(tValues);
+    EXPECT_EQ(tExact[0], Fraction<int64_t>(3, 8));
+    EXPECT_EQ(tExact[1], Fraction<int64_t>(-6, 1));
+    EXPECT_EQ(tExact[2], Fraction<int64_t>(3602879701896397, int64_t(1) << 55));
+    EXPECT_EQ(tExact[4], Fraction<int64_t>(0, 1));
+    for (std::size_t i = 0; i < tValues.size(); ++i)
+        EXPECT_EQ(tExact[i], to_Fraction_bounded(tValues[i], std::numeric_limits<int64_t>::max())) << i;
+
+    const auto tBounded = column_from_double<int32_t>(tValues, 1000);
+    EXPECT_EQ(tBounded[2], Fraction<int32_t>(1, 10));
+    EXPECT_EQ(tBounded[5], Fraction<int32_t>(1, 3));
+    EXPECT_THROW((void)column_from_double<int32_t>(std::vector<double>{1e12}), std::overflow_error);
+    EXPECT_THROW((void)column_from_double<int32_t>(std::vector<double>{std::numeric_limits<double>::infinity()}), std::invalid_argument);
+
+    // The lowest value of a signed type is a power of two with one bit more than digits.
+    const std::vector<double> tLowest{-0x1p63, -0x1p62};
+    EXPECT_EQ(column_from_double<int64_t>(tLowest)[0], Fraction<int64_t>(std::numeric_limits<int64_t>::lowest(), 1));
+    EXPECT_EQ(column_from_double<int64_t>(tLowest)[1], Fraction<int64_t>(-(int64_t(1) << 62), 1));
+    EXPECT_EQ(column_from_double<int32_t>(std::vector<double>{-0x1p31})[0], Fraction<int32_t>(std::numeric_limits<int32_t>::lowest(), 1));
+    EXPECT_THROW((void)column_from_double<int64_t>(std::vector<double>{0x1p63}), std::overflow_error);
+
+    // Magnitudes at the 2^53 boundary of the exactness check.
+    constexpr int64_t kExact = int64_t(1) << 53;
+    const FractionColumn<int64_t> tBoundary{{kExact, -kExact, kExact + 1, std::numeric_limits<int64_t>::lowest()}, {3, 3, 1, 1}};
+    std::vector<double> tBoundaryOut(tBoundary.size());
+    column_to_double(tBoundary, std::span{tBoundaryOut});
+    EXPECT_EQ(tBoundaryOut[0], 0x1p53 / 3.0);
+    EXPECT_EQ(tBoundaryOut[1], -0x1p53 / 3.0);
+    EXPECT_EQ(tBoundaryOut[2], 0x1p53);
+    EXPECT_EQ(tBoundaryOut[3], -0x1p63);
+}
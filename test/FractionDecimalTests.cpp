@@ -0,0 +1,72 @@
+#include "FractionDecimal.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+struct FractionDecimalTest : public testing::Test
+{
+};
+
+TEST_F(FractionDecimalTest, Expansion)
+{
+    const auto tSeventh = decimal_expansion(Fraction<int>{1, 7});
+    EXPECT_FALSE(tSeventh.negative);
+    EXPECT_EQ(tSeventh.preperiod, 0u);
+    EXPECT_EQ(tSeventh.period, 6u);
+
+    const auto tSixth = decimal_expansion(Fraction<int>{-7, 6});
+    EXPECT_TRUE(tSixth.negative);
+    EXPECT_EQ(tSixth.integerPart, 1u);
+    EXPECT_EQ(tSixth.preperiod, 1u);
+    EXPECT_EQ(tSixth.period, 1u);
+
+    EXPECT_EQ(decimal_expansion(Fraction<int>{3, 8}).period, 0u);
+    EXPECT_EQ(decimal_expansion(Fraction<int>{3, 8}).preperiod, 3u);
+    EXPECT_EQ(decimal_expansion(Fraction<int>{14, 7}).preperiod, 0u);
+
+    // 1 / 9999999967 has a repetend of 9999999966 digits.
+    EXPECT_EQ(decimal_expansion(Fraction<int64_t>{1, 9999999967}).period, 9999999966u);
+    EXPECT_EQ(decimal_expansion(Fraction<int64_t>{5, 3 * 7 * 11 * 13 * 40}).period, 6u);
+}
+
+TEST_F(FractionDecimalTest, Strings)
+{
+    EXPECT_EQ(to_decimal_string(Fraction<int>{1, 7}), "0.(142857)");
+    EXPECT_EQ(to_decimal_string(Fraction<int>{-7, 6}), "-1.1(6)");
+    EXPECT_EQ(to_decimal_string(Fraction<int>{5, -4}), "-1.25");
+    EXPECT_EQ(to_decimal_string(Fraction<int>{0, -3}), "0");
+    EXPECT_EQ(to_decimal_string(Fraction<uint64_t>{std::numeric_limits<uint64_t>::max(), 1}), "18446744073709551615");
+    EXPECT_THROW((void)to_decimal_string(Fraction<int>{1, 7}, 5), std::length_error);
+
+    std::string tDigits(6, ' ');
+    decimal_digits(Fraction<int64_t>{1, 9999999967}, 9999999966, tDigits);
+    std::string tStart(6, ' ');
+    decimal_digits(Fraction<int64_t>{1, 9999999967}, 0, tStart);
+    EXPECT_EQ(tDigits, tStart);
+    EXPECT_EQ(tStart, "000000");
+
+    decimal_digits(Fraction<uint64_t>{std::numeric_limits<uint64_t>::max() - 1, std::numeric_limits<uint64_t>::max()}, 0, tDigits);
+    EXPECT_EQ(tDigits, "999999");
+}
+
+TEST_F(FractionDecimalTest, Rounding)
+{
+    const Fraction<int> tTie{-5, 4}; // -1.25
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::HalfEven), "-1.2");
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::HalfUp), "-1.3");
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::HalfDown), "-1.2");
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::Floor), "-1.3");
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::Ceiling), "-1.2");
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::TowardZero), "-1.2");
+    EXPECT_EQ(round_decimal(tTie, 1, RoundingMode::AwayFromZero), "-1.3");
+    EXPECT_EQ(round_decimal(tTie, 3), "-1.250");
+
+    EXPECT_EQ(round_decimal(Fraction<int>{2, 3}, 4), "0.6667");
+    EXPECT_EQ(round_decimal(Fraction<int>{2, 3}, 0), "1");
+    EXPECT_EQ(round_decimal(Fraction<int>{1999, 200}, 1, RoundingMode::HalfEven), "10.0");
+    EXPECT_EQ(round_decimal(Fraction<int>{-1, 300}, 2), "0.00");
+    EXPECT_EQ(round_decimal(Fraction<int>{5, 2}, 0, RoundingMode::HalfEven), "2");
+    EXPECT_EQ(round_decimal(Fraction<int>{7, 2}, 0, RoundingMode::HalfEven), "4");
+}
@@ -0,0 +1,70 @@
+#include "FractionDivisor.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+struct FractionDivisorTest : public testing::Test
+{
+};
+
+template <typename Type>
+static void checkDivisor(const Type &xDivisor, std::mt19937_64 &xGen)
+{
+    const FastDivisor<Type> tDivisor{xDivisor};
+    for (Type tValue : {std::numeric_limits<Type>::min(), std::numeric_limits<Type>::max(), Type(0), Type(1), xDivisor})
+    {
+        if (std::is_signed_v<Type> && tValue == std::numeric_limits<Type>::min() && xDivisor == Type(-1))
+            continue;
+        ASSERT_EQ(tValue / tDivisor, static_cast<Type>(tValue / xDivisor)) << +tValue << " / " << +xDivisor;
+    }
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto tValue = static_cast<Type>(xGen());
+        if (std::is_signed_v<Type> && tValue == std::numeric_limits<Type>::min() && xDivisor == Type(-1))
+            continue;
+        ASSERT_EQ(tValue / tDivisor, static_cast<Type>(tValue / xDivisor)) << +tValue << " / " << +xDivisor;
+        ASSERT_EQ(tValue % tDivisor, static_cast<Type>(tValue % xDivisor)) << +tValue << " % " << +xDivisor;
+    }
+}
+
+TEST_F(FractionDivisorTest, MatchesHardwareDivision)
+{
+    std::mt19937_64 tGen{17};
+    std::uniform_int_distribution<uint64_t> tDist;
+
+    for (uint64_t d : std::initializer_list<uint64_t>{1ull, 2ull, 3ull, 5ull, 6ull, 7ull, 641ull, 1ull << 32, (1ull << 63) + 1, std::numeric_limits<uint64_t>::max()})
+        checkDivisor<uint64_t>(d, tGen);
+    for (int i = 0; i < 100; ++i)
+    {
+        checkDivisor<uint64_t>(tDist(tGen) | 1, tGen);
+        checkDivisor<uint32_t>(static_cast<uint32_t>(tDist(tGen)) | 1, tGen);
+        checkDivisor<int64_t>(static_cast<int64_t>(tDist(tGen) >> (i % 60)) | 1, tGen);
+        checkDivisor<int32_t>(-static_cast<int32_t>((tDist(tGen) >> 40) | 1), tGen);
+        checkDivisor<int16_t>(static_cast<int16_t>((tDist(tGen) % 1000) + 1), tGen);
+    }
+    checkDivisor<int8_t>(int8_t{-3}, tGen);
+    checkDivisor<int64_t>(std::numeric_limits<int64_t>::min(), tGen);
+
+    EXPECT_THROW(FastDivisor<int>{0}, std::invalid_argument);
+}
+
+TEST_F(FractionDivisorTest, BatchHelpers)
+{
+    std::vector<int64_t> tNumerators{21, -35, 70, 7};
+    divide_all(std::span<int64_t>{tNumerators}, FastDivisor<int64_t>{7});
+    EXPECT_EQ(tNumerators, (std::vector<int64_t>{3, -5, 10, 1}));
+
+    rescale_all(std::span<int64_t>{tNumerators}, int64_t{4}, int64_t{12});
+    EXPECT_EQ(tNumerators, (std::vector<int64_t>{9, -15, 30, 3}));
+
+    std::vector<Fraction<int64_t>> tFractions{Fraction<int64_t>{6, 12}, Fraction<int64_t>{-18, 12}, Fraction<int64_t>{30, 12},
+                                              Fraction<int64_t>{5, 12}, Fraction<int64_t>{3, -6}};
+    simplify_all(std::span<Fraction<int64_t>>{tFractions});
+    EXPECT_EQ(tFractions[0], Fraction<int64_t>(1, 2));
+    EXPECT_EQ(tFractions[1], Fraction<int64_t>(-3, 2));
+    EXPECT_EQ(tFractions[2], Fraction<int64_t>(5, 2));
+    EXPECT_EQ(tFractions[3], Fraction<int64_t>(5, 12));
+    EXPECT_EQ(tFractions[4], Fraction<int64_t>(-1, 2));
+}
@@ -0,0 +1,67 @@
+#include "FractionExpected.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+struct FractionExpectedTest : public testing::Test
+{
+};
+
+TEST_F(FractionExpectedTest, Factories)
+{
+    constexpr auto tRaw = Fraction<int>::from_raw(6, 4);
+    static_assert(tRaw.getNumerator() == 6 && tRaw.getDenominator() == 4);
+
+    const auto tValue = make_Fraction(3, 4);
+    ASSERT_TRUE(tValue.has_value());
+    EXPECT_EQ(*tValue, Fraction<int>(3, 4));
+    EXPECT_EQ(make_Fraction(7).value(), Fraction<int>(7, 1));
+
+    const auto tZero = make_Fraction(1, 0);
+    EXPECT_FALSE(tZero);
+    EXPECT_EQ(tZero.error(), FractionError::ZeroDenominator);
+    EXPECT_EQ(tZero.value_or(Fraction<int>(0, 1)), Fraction<int>(0, 1));
+
+    EXPECT_EQ(try_to_Fraction(0.75, 100).value(), Fraction<int>(3, 4));
+    EXPECT_EQ(try_to_Fraction(std::numeric_limits<double>::quiet_NaN(), 100).error(), FractionError::NotFinite);
+    EXPECT_EQ(try_to_Fraction(0.5, 0).error(), FractionError::InvalidArgument);
+    EXPECT_EQ(try_to_Fraction(1e12, 10).error(), FractionError::Overflow);
+    EXPECT_EQ(try_to_Fraction(-0.5, 10u).error(), FractionError::Overflow);
+}
+
+TEST_F(FractionExpectedTest, CheckedArithmetic)
+{
+    const Fraction<int32_t> tHalf{1, 2};
+    const Fraction<int32_t> tThird{1, 3};
+    EXPECT_EQ(checked_add(tHalf, tThird).value(), Fraction<int32_t>(5, 6));
+    EXPECT_EQ(checked_sub(tThird, tHalf).value(), Fraction<int32_t>(-1, 6));
+    EXPECT_EQ(checked_mul(tHalf, tThird).value(), Fraction<int32_t>(1, 6));
+    EXPECT_EQ(checked_div(tHalf, tThird).value(), Fraction<int32_t>(3, 2));
+
+    EXPECT_EQ(checked_div(tHalf, Fraction<int32_t>(0, 5)).error(), FractionError::DivisionByZero);
+    EXPECT_EQ(checked_add(tHalf, Fraction<int32_t>::from_raw(1, 0)).error(), FractionError::ZeroDenominator);
+    EXPECT_EQ(checked_div(Fraction<int32_t>(3, 4), Fraction<int32_t>::from_raw(5, 0)).error(), FractionError::ZeroDenominator);
+    EXPECT_EQ(checked_div(Fraction<int32_t>::from_raw(3, 0), Fraction<int32_t>(5, 1)).error(), FractionError::ZeroDenominator);
+
+    constexpr int32_t kMax = std::numeric_limits<int32_t>::max();
+    EXPECT_EQ(checked_add(Fraction<int32_t>(kMax, 1), Fraction<int32_t>(1, 1)).error(), FractionError::Overflow);
+    EXPECT_EQ(checked_sub(Fraction<int32_t>(std::numeric_limits<int32_t>::min(), 1), Fraction<int32_t>(1, 1)).error(), FractionError::Overflow);
+    EXPECT_EQ(checked_mul(Fraction<int32_t>(kMax, 3), Fraction<int32_t>(5, 7)).error(), FractionError::Overflow);
+    // Cross cancellation avoids the intermediate overflow.
+    EXPECT_EQ(checked_mul(Fraction<int32_t>(kMax, 3), Fraction<int32_t>(3, kMax)).value(), Fraction<int32_t>(1, 1));
+    // A common factor of the denominators is divided out before multiplying.
+    EXPECT_EQ(checked_add(Fraction<int32_t>(1, 1 << 30), Fraction<int32_t>(1, 1 << 30)).value(), Fraction<int32_t>(1, 1 << 29));
+
+    EXPECT_THROW((void)checked_mul(Fraction<int32_t>(kMax, 3), Fraction<int32_t>(5, 7)).value(), FractionBadAccess);
+    try
+    {
+        (void)checked_div(tHalf, Fraction<int32_t>(0, 5)).value();
+        FAIL();
+    }
+    catch (const FractionBadAccess &xError)
+    {
+        EXPECT_EQ(xError.error(), FractionError::DivisionByZero);
+    }
+}
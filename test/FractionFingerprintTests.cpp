@@ -0,0 +1,58 @@
+#include "FractionFingerprint.h"
+
+#include <gtest/gtest.h>
+#include <unordered_set>
+
+struct FractionFingerprintTest : public testing::Test
+{
+};
+
+TEST_F(FractionFingerprintTest, EqualValuesMatch)
+{
+    const FingerprintContext<3> tContext{1234};
+
+    EXPECT_EQ(tContext(Fraction(1, 2)), tContext(Fraction(2, 4)));
+    EXPECT_EQ(tContext(Fraction(-1, 2)), tContext(Fraction(1, -2)));
+    EXPECT_FALSE(tContext(Fraction(1, 2)) == tContext(Fraction(1, 3)));
+
+    // Small integers have the same residues modulo any prime; only the context tells them apart.
+    const FingerprintContext<3> tOther{4321};
+    const FingerprintContext<3> tSame{1234};
+    EXPECT_FALSE(tContext.fromInteger(5) == tOther.fromInteger(5));
+    EXPECT_TRUE(tContext.fromInteger(5) == tSame.fromInteger(5));
+    EXPECT_TRUE(tContext(Fraction(1, 2)) == tSame(Fraction(1, 2)));
+    EXPECT_EQ(tContext(Fraction(6, 3)), tContext.fromInteger(2));
+}
+
+TEST_F(FractionFingerprintTest, Arithmetic)
+{
+    const FingerprintContext<2> tContext{99};
+
+    const auto a = Fraction<int64_t>{3, 4};
+    const auto b = Fraction<int64_t>{2, 5};
+
+    EXPECT_EQ(tContext(a) + tContext(b), tContext(a + b));
+    EXPECT_EQ(tContext(a) - tContext(b), tContext(a - b));
+    EXPECT_EQ(tContext(a) * tContext(b), tContext(a * b));
+    EXPECT_EQ(tContext(a) / tContext(b), tContext(a / b));
+
+    // sum_{k=1}^{40} 1/(k(k+1)) == 40/41 without ever forming the exact sum.
+    auto tSum = tContext(Fraction<int64_t>{0, 1});
+    for (int64_t k = 1; k <= 40; ++k)
+        tSum += tContext(Fraction<int64_t>{1, k * (k + 1)});
+    EXPECT_EQ(tSum, tContext(Fraction<int64_t>{40, 41}));
+
+    EXPECT_THROW(tSum /= tContext(Fraction<int64_t>{0, 1}), std::invalid_argument);
+}
+
+TEST_F(FractionFingerprintTest, Hash)
+{
+    const FingerprintContext<2> tContext{5};
+
+    std::unordered_set<Fingerprint<2>> tSet;
+    tSet.insert(tContext(Fraction(1, 2)));
+    tSet.insert(tContext(Fraction(2, 4)));
+    tSet.insert(tContext(Fraction(1, 3)));
+
+    EXPECT_EQ(tSet.size(), 2u);
+}
@@ -0,0 +1,98 @@
+#include "Fraction.h"
+#include "FractionGCD.h"
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+
+struct FractionGCDTest : public testing::Test
+{
+};
+
+TEST_F(FractionGCDTest, Euclid)
+{
+    EXPECT_EQ(euclid_GCD(12, 18), 6);
+    EXPECT_EQ(euclid_GCD(-12, 18), 6);
+    EXPECT_EQ(euclid_GCD(0, 7), 7);
+    EXPECT_EQ(euclid_GCD(7, 0), 7);
+    EXPECT_EQ(euclid_GCD(0, 0), 0);
+}
+
+TEST_F(FractionGCDTest, Binary)
+{
+    std::mt19937_64 tGen{42};
+    std::uniform_int_distribution<int64_t> tDist{-1'000'000'000'000, 1'000'000'000'000};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto a = tDist(tGen);
+        const auto b = tDist(tGen);
+        EXPECT_EQ(binary_GCD(a, b), std::gcd(a, b));
+    }
+
+    EXPECT_EQ(binary_GCD<uint8_t>(0, 0), 0);
+    EXPECT_EQ(binary_GCD<int32_t>(INT32_MIN, 0), INT32_MIN);
+}
+
+#ifdef __SIZEOF_INT128__
+TEST_F(FractionGCDTest, Lehmer)
+{
+    using U128 = unsigned __int128;
+
+    std::mt19937_64 tGen{7};
+    for (int i = 0; i < 1000; ++i)
+    {
+        const U128 tCommon = tGen() >> 20;
+        const U128 a = tCommon * (tGen() >> 1);
+        const U128 b = tCommon * (tGen() >> 3);
+        EXPECT_TRUE(lehmer_GCD(a, b) == euclid_GCD(a, b));
+    }
+
+    // Full-width operands: near-equal pairs end the inner loop after one step (cofactors 0 and 1).
+    for (int i = 0; i < 20000; ++i)
+    {
+        const U128 a = (static_cast<U128>(tGen()) << 64) | tGen();
+        const auto k = static_cast<int>(tGen() % 120) + 1;
+        const U128 b = i % 2 == 0 ? a - (a >> k) : a >> k;
+        ASSERT_TRUE(lehmer_GCD(a, b) == euclid_GCD(a, b)) << i;
+        ASSERT_TRUE(fraction_GCD(static_cast<__int128>(a >> 1), -static_cast<__int128>(b >> 1)) == static_cast<__int128>(euclid_GCD(a >> 1, b >> 1))) << i;
+    }
+
+    const U128 tFib1 = (static_cast<U128>(1) << 100) + 12345;
+    EXPECT_TRUE(lehmer_GCD(tFib1, U128{0}) == tFib1);
+    EXPECT_TRUE(lehmer_GCD(U128{0}, tFib1) == tFib1);
+}
+#endif
+
+TEST_F(FractionGCDTest, Simplify)
+{
+    Fraction<int> tZero{0, 5};
+    tZero.simplify();
+    EXPECT_EQ(tZero, Fraction(0, 1));
+
+    Fraction<int> tNegative{-6, 8};
+    tNegative.simplify();
+    EXPECT_EQ(tNegative, Fraction(-3, 4));
+    EXPECT_EQ(Fraction(-6, 8).GCD(), 2);
+}
+
+TEST_F(FractionGCDTest, SmallTable)
+{
+    for (int a = -255; a < 256; ++a)
+    {
+        for (int b = -255; b < 256; b += 7)
+        {
+            EXPECT_EQ(table_GCD(a, b), std::gcd(a, b));
+        }
+    }
+
+    static_assert(kSmallGCDTable[12 * 256 + 18] == 6);
+    EXPECT_EQ(fraction_GCD<int8_t>(-128, 64), 64);
+    EXPECT_EQ(fraction_GCD<uint16_t>(65535, 255), 255);
+    EXPECT_EQ(fraction_GCD<uint64_t>(UINT64_MAX, 5), 5u);
+    EXPECT_EQ(fraction_GCD<int64_t>(-256, 255), 1);
+
+    Fraction<int8_t> tFraction{int8_t{-100}, int8_t{120}};
+    tFraction.simplify();
+    EXPECT_EQ(tFraction, Fraction<int8_t>(int8_t{-5}, int8_t{6}));
+}
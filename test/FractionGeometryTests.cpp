@@ -0,0 +1,95 @@
+#include "FractionGeometry.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+struct FractionGeometryTest : public testing::Test
+{
+    template <typename Type>
+    static FractionPoint2<Type> point(Type xn, Type xd, Type yn, Type yd)
+    {
+        return {Fraction<Type>{xn, xd}, Fraction<Type>{yn, yd}};
+    }
+
+    template <typename Type>
+    static FractionPoint3<Type> point(Type xn, Type xd, Type yn, Type yd, Type zn, Type zd)
+    {
+        return {Fraction<Type>{xn, xd}, Fraction<Type>{yn, yd}, Fraction<Type>{zn, zd}};
+    }
+};
+
+TEST_F(FractionGeometryTest, Orientation)
+{
+    EXPECT_EQ(orientation(point(0, 1, 0, 1), point(1, 1, 0, 1), point(0, 1, 1, 1)), 1);
+    EXPECT_EQ(orientation(point(0, 1, 0, 1), point(0, 1, 1, 1), point(1, 1, 0, 1)), -1);
+    EXPECT_EQ(orientation(point(0, 1, 0, 1), point(1, 3, 1, 3), point(2, -3, -4, 6)), 0);
+
+    // Points whose slopes only differ far beyond double precision.
+    constexpr int64_t kBig = std::numeric_limits<int64_t>::max();
+    const auto a = point<int64_t>(0, 1, 0, 1);
+    const auto b = point<int64_t>(1, kBig, 1, kBig - 1);
+    EXPECT_EQ(orientation(a, b, point<int64_t>(2, kBig, 2, kBig - 1)), 0);
+    EXPECT_EQ(orientation(a, b, point<int64_t>(2, kBig, 2, kBig - 2)), 1);
+    EXPECT_EQ(orientation(a, b, point<int64_t>(-2, -kBig, 2, kBig)), -1);
+
+    const auto o = point<int64_t>(0, 1, 0, 1, 0, 1);
+    const auto x = point<int64_t>(1, 1, 0, 1, 0, 1);
+    const auto y = point<int64_t>(0, 1, 1, 1, 0, 1);
+    EXPECT_EQ(orientation(o, x, y, point<int64_t>(0, 1, 0, 1, 1, kBig)), 1);
+    EXPECT_EQ(orientation(o, x, y, point<int64_t>(0, 1, 0, 1, -1, kBig)), -1);
+    EXPECT_EQ(orientation(o, x, y, point<int64_t>(1, 3, kBig - 1, kBig, 0, 7)), 0);
+}
+
+TEST_F(FractionGeometryTest, InCircle)
+{
+    const auto a = point<int64_t>(1, 1, 0, 1);
+    const auto b = point<int64_t>(0, 1, 1, 1);
+    const auto c = point<int64_t>(-1, 1, 0, 1);
+    EXPECT_EQ(in_circle(a, b, c, point<int64_t>(0, 1, 0, 1)), 1);
+    EXPECT_EQ(in_circle(a, b, c, point<int64_t>(3, 5, -4, 5)), 0);
+    EXPECT_EQ(in_circle(a, b, c, point<int64_t>(3, 5, -4000001, 5000000)), -1);
+    EXPECT_EQ(in_circle(a, b, c, point<int64_t>(3, 5, -3999999, 5000000)), 1);
+    EXPECT_EQ(in_circle(a, b, c, point<int64_t>(-3, -5, 4000000000000, -5000000000000)), 0);
+}
+
+TEST_F(FractionGeometryTest, SegmentsAndBatch)
+{
+    EXPECT_TRUE(segments_intersect(point(0, 1, 0, 1), point(1, 1, 1, 1), point(0, 1, 1, 1), point(1, 1, 0, 1)));
+    EXPECT_TRUE(segments_intersect(point(0, 1, 0, 1), point(1, 1, 1, 1), point(1, 2, 2, 4), point(2, 1, 0, 1)));
+    EXPECT_FALSE(segments_intersect(point(0, 1, 0, 1), point(1, 1, 1, 1), point(2, 1, 2, 1), point(3, 1, 3, 1)));
+    EXPECT_FALSE(segments_intersect(point(0, 1, 0, 1), point(1, 1, 0, 1), point(0, 1, 1, 3), point(1, 1, 1, 3)));
+
+    std::mt19937 tGen{3};
+    std::uniform_int_distribution<int> tNum{-100, 100};
+    std::uniform_int_distribution<int> tDen{1, 9};
+    std::vector<FractionPoint2<int>> tPoints;
+    for (int i = 0; i < 200; ++i)
+        tPoints.push_back(point(tNum(tGen), tDen(tGen), tNum(tGen), -tDen(tGen)));
+
+    const auto a = point(-1, 2, 1, 3);
+    const auto b = point(5, 7, -2, 9);
+    std::vector<int> tOut(tPoints.size());
+    orientation_batch<int>(a, b, tPoints, tOut);
+    for (std::size_t i = 0; i < tPoints.size(); ++i)
+        EXPECT_EQ(tOut[i], orientation(a, b, tPoints[i])) << i;
+
+    EXPECT_THROW(orientation_batch<int>(a, b, tPoints, std::span{tOut}.first(3)), std::invalid_argument);
+}
+
+TEST_F(FractionGeometryTest, ConvexHull)
+{
+    const std::vector<FractionPoint2<int>> tPoints{point(0, 1, 0, 1), point(2, 1, 0, 1), point(4, 2, 4, 2), point(0, 1, 2, 1),
+                                                   point(1, 1, 1, 1), point(1, 1, 0, 1), point(1, 3, 5, 3), point(0, 1, 0, 5)};
+    const auto tHull = convex_hull<int>(tPoints);
+    ASSERT_EQ(tHull.size(), 4u);
+    const std::vector<std::pair<double, double>> tExpected{{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}};
+    for (std::size_t i = 0; i < tHull.size(); ++i)
+    {
+        EXPECT_EQ(tHull[i].x.to_double(), tExpected[i].first) << i;
+        EXPECT_EQ(tHull[i].y.to_double(), tExpected[i].second) << i;
+        EXPECT_EQ(orientation(tHull[i], tHull[(i + 1) % tHull.size()], tHull[(i + 2) % tHull.size()]), 1);
+    }
+}
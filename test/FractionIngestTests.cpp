@@ -0,0 +1,83 @@
+#include "FractionIngest.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+struct FractionIngestTest : public testing::Test
+{
+};
+
+TEST_F(FractionIngestTest, ParseFraction)
+{
+    int64_t n = 0;
+    int64_t d = 0;
+    const std::string tText = "  -3 / 4 ";
+    auto tResult = parse_fraction(tText.data(), tText.data() + tText.size(), n, d);
+    EXPECT_EQ(tResult.ec, std::errc{});
+    EXPECT_EQ(tResult.ptr, tText.data() + tText.size());
+    EXPECT_EQ(n, -3);
+    EXPECT_EQ(d, 4);
+
+    const std::string tInteger = "+17";
+    tResult = parse_fraction(tInteger.data(), tInteger.data() + tInteger.size(), n, d);
+    EXPECT_EQ(tResult.ec, std::errc{});
+    EXPECT_EQ(n, 17);
+    EXPECT_EQ(d, 1);
+
+    const std::string tZero = "1/0";
+    EXPECT_EQ(parse_fraction(tZero.data(), tZero.data() + tZero.size(), n, d).ec, std::errc::invalid_argument);
+    const std::string tEmpty = "/2";
+    EXPECT_EQ(parse_fraction(tEmpty.data(), tEmpty.data() + tEmpty.size(), n, d).ec, std::errc::invalid_argument);
+
+    int8_t tSmall = 0;
+    int8_t tSmallDenominator = 0;
+    const std::string tLarge = "1/300";
+    EXPECT_EQ(parse_fraction(tLarge.data(), tLarge.data() + tLarge.size(), tSmall, tSmallDenominator).ec, std::errc::result_out_of_range);
+}
+
+TEST_F(FractionIngestTest, ParallelColumn)
+{
+    std::string tText = "id;ratio\n";
+    for (int i = 0; i < 5000; ++i)
+        tText += std::to_string(i) + ";" + std::to_string(i - 2500) + "/" + std::to_string(i % 7 + 1) + (i % 3 == 0 ? "\r\n" : "\n");
+    tText += "\n";
+
+    const FractionIngestOptions tOptions{';', 1, true, {4, 64}};
+    const auto tColumn = ingest_fraction_column<int32_t>(tText, tOptions);
+    ASSERT_EQ(tColumn.size(), 5000u);
+    for (std::size_t i = 0; i < tColumn.size(); ++i)
+    {
+        EXPECT_EQ(tColumn.getNumerators()[i], static_cast<int32_t>(i) - 2500);
+        EXPECT_EQ(tColumn.getDenominators()[i], static_cast<int32_t>(i % 7 + 1));
+    }
+
+    // Malformed fraction, zero denominator and a line without the field.
+    EXPECT_THROW((void)ingest_fraction_column<int32_t>("h\n0;1/2\n1;3/x\n", tOptions), std::invalid_argument);
+    EXPECT_THROW((void)ingest_fraction_column<int32_t>("h\n0;1/2\n1;3/0\n", tOptions), std::invalid_argument);
+    EXPECT_THROW((void)ingest_fraction_column<int32_t>("h\n0;1/2\n1\n", tOptions), std::invalid_argument);
+    EXPECT_EQ(ingest_fraction_column<int32_t>("h\n0;1/2\n1;3/4\n", tOptions).size(), 2u);
+    EXPECT_THROW((void)ingest_fraction_column<int8_t>("1/2\n3/400\n"), std::out_of_range);
+}
+
+TEST_F(FractionIngestTest, File)
+{
+    const auto tPath = std::filesystem::temp_directory_path() / "FractionIngestTest.csv";
+    {
+        std::ofstream tFile{tPath};
+        tFile << "1/2,a\n-7,b\n 5 / 3 ,c";
+    }
+    const auto tColumn = ingest_fraction_file<int64_t>(tPath);
+    std::filesystem::remove(tPath);
+
+    ASSERT_EQ(tColumn.size(), 3u);
+    EXPECT_EQ(tColumn[0], Fraction<int64_t>(1, 2));
+    EXPECT_EQ(tColumn[1], Fraction<int64_t>(-7, 1));
+    EXPECT_EQ(tColumn[2], Fraction<int64_t>(5, 3));
+
+    EXPECT_THROW((void)ingest_fraction_file<int64_t>(tPath), std::system_error);
+}
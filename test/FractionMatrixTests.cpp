@@ -0,0 +1,155 @@
+#include "FractionMatrix.h"
+
+#include <gtest/gtest.h>
+#include <random>
+
+struct FractionMatrixTest : public testing::Test
+{
+};
+
+TEST_F(FractionMatrixTest, Determinant)
+{
+    const FractionMatrix<int64_t> tMatrix{
+        {Fraction<int64_t>{1, 2}, Fraction<int64_t>{1, 3}},
+        {Fraction<int64_t>{1, 4}, Fraction<int64_t>{1, 5}},
+    };
+
+    // 1/10 - 1/12 = 1/60
+    EXPECT_EQ(multimodular_determinant(tMatrix), Fraction<int64_t>(1, 60));
+    EXPECT_EQ(bareiss_determinant(tMatrix), Fraction<int64_t>(1, 60));
+
+    const FractionMatrix<int64_t> tSingular{
+        {Fraction<int64_t>{1}, Fraction<int64_t>{2}},
+        {Fraction<int64_t>{2}, Fraction<int64_t>{4}},
+    };
+    EXPECT_EQ(multimodular_determinant(tSingular), Fraction<int64_t>(0, 1));
+
+    EXPECT_THROW(auto tTemp = multimodular_determinant(FractionMatrix<int64_t>(2, 3)), std::invalid_argument);
+
+    // Hadamard's bound of about 166 bits needs more primes than the __int128 reconstruction holds.
+    constexpr int64_t kLarge = int64_t(1) << 40;
+    FractionMatrix<int64_t> tLarge(4, 4);
+    for (std::size_t r = 0; r < 4; ++r)
+        for (std::size_t c = 0; c < 4; ++c)
+            tLarge(r, c) = Fraction<int64_t>{r == c ? kLarge : kLarge - int64_t(r + c)};
+    EXPECT_THROW(auto tTemp = multimodular_determinant(tLarge), std::overflow_error);
+
+    // diag(1/p_i): the product of the row denominators does not fit into int64_t.
+    constexpr int64_t kPrimes[] = {1000003, 1000033, 1000037, 1000039, 1000081, 1000099, 1000117, 1000121,
+                                   1000133, 1000151, 1000159, 1000171, 1000183, 1000187, 1000193, 1000199};
+    FractionMatrix<int64_t> tDiagonal(16, 16);
+    for (std::size_t i = 0; i < 16; ++i)
+        tDiagonal(i, i) = Fraction<int64_t>{1, kPrimes[i]};
+    EXPECT_THROW(auto tTemp = multimodular_determinant(tDiagonal), std::overflow_error);
+    EXPECT_THROW(auto tTemp = bareiss_determinant(tDiagonal), std::overflow_error);
+}
+
+TEST_F(FractionMatrixTest, DeterminantMatchesBareiss)
+{
+    std::mt19937_64 tGen{3};
+    std::uniform_int_distribution<int64_t> tDist{-9, 9};
+
+    for (std::size_t n = 1; n <= 7; ++n)
+    {
+        FractionMatrix<int64_t> tMatrix(n, n);
+        for (std::size_t r = 0; r < n; ++r)
+            for (std::size_t c = 0; c < n; ++c)
+                tMatrix(r, c) = Fraction<int64_t>{tDist(tGen), 1 + (tDist(tGen) + 9) % 3};
+
+        EXPECT_EQ(multimodular_determinant(tMatrix, {.earlyTermination = false, .threads = 2}), bareiss_determinant(tMatrix));
+        EXPECT_EQ(multimodular_determinant(tMatrix), bareiss_determinant(tMatrix));
+    }
+}
+
+TEST_F(FractionMatrixTest, Solve)
+{
+    const FractionMatrix<int64_t> tMatrix{
+        {Fraction<int64_t>{2}, Fraction<int64_t>{1}, Fraction<int64_t>{-1}},
+        {Fraction<int64_t>{-3}, Fraction<int64_t>{-1}, Fraction<int64_t>{2}},
+        {Fraction<int64_t>{-2}, Fraction<int64_t>{1}, Fraction<int64_t>{2}},
+    };
+    const std::vector<Fraction<int64_t>> tRhs{Fraction<int64_t>{8}, Fraction<int64_t>{-11}, Fraction<int64_t>{-3}};
+
+    const auto tSolution = multimodular_solve(tMatrix, std::span<const Fraction<int64_t>>{tRhs});
+    ASSERT_EQ(tSolution.size(), 3u);
+    EXPECT_EQ(tSolution[0], Fraction<int64_t>(2, 1));
+    EXPECT_EQ(tSolution[1], Fraction<int64_t>(3, 1));
+    EXPECT_EQ(tSolution[2], Fraction<int64_t>(-1, 1));
+
+    const FractionMatrix<int64_t> tRational{
+        {Fraction<int64_t>{1, 2}, Fraction<int64_t>{1, 3}},
+        {Fraction<int64_t>{1, 4}, Fraction<int64_t>{1, 5}},
+    };
+    const std::vector<Fraction<int64_t>> tRhs2{Fraction<int64_t>{1}, Fraction<int64_t>{1, 7}};
+    const auto tSolution2 = multimodular_solve(tRational, std::span<const Fraction<int64_t>>{tRhs2});
+    for (std::size_t r = 0; r < 2; ++r)
+    {
+        auto tSum = tRational(r, 0) * tSolution2[0] + tRational(r, 1) * tSolution2[1];
+        auto tExpected = tRhs2[r];
+        EXPECT_EQ(tSum.simplify(), tExpected.simplify());
+    }
+
+    const FractionMatrix<int64_t> tSingular{
+        {Fraction<int64_t>{1}, Fraction<int64_t>{2}},
+        {Fraction<int64_t>{2}, Fraction<int64_t>{4}},
+    };
+    EXPECT_THROW(auto tTemp = multimodular_solve(tSingular, std::span<const Fraction<int64_t>>{tRhs2}), std::invalid_argument);
+}
+
+TEST_F(FractionMatrixTest, DixonSolve)
+{
+    const FractionMatrix<int64_t> tMatrix{
+        {Fraction<int64_t>{2}, Fraction<int64_t>{1}, Fraction<int64_t>{-1}},
+        {Fraction<int64_t>{-3}, Fraction<int64_t>{-1}, Fraction<int64_t>{2}},
+        {Fraction<int64_t>{-2}, Fraction<int64_t>{1}, Fraction<int64_t>{2}},
+    };
+    const std::vector<Fraction<int64_t>> tRhs{Fraction<int64_t>{8}, Fraction<int64_t>{-11}, Fraction<int64_t>{-3}};
+    const auto tSolution = dixon_solve(tMatrix, std::span<const Fraction<int64_t>>{tRhs});
+    ASSERT_EQ(tSolution.size(), 3u);
+    EXPECT_EQ(tSolution[0], Fraction<int64_t>(2, 1));
+    EXPECT_EQ(tSolution[1], Fraction<int64_t>(3, 1));
+    EXPECT_EQ(tSolution[2], Fraction<int64_t>(-1, 1));
+
+    std::mt19937_64 tGen{11};
+    std::uniform_int_distribution<int64_t> tDist{-20, 20};
+    for (std::size_t n = 2; n <= 6; ++n)
+    {
+        FractionMatrix<int64_t> tRandom(n, n);
+        std::vector<Fraction<int64_t>> tRandomRhs;
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            for (std::size_t c = 0; c < n; ++c)
+                tRandom(r, c) = Fraction<int64_t>{tDist(tGen), 1 + (tDist(tGen) + 20) % 4};
+            tRandomRhs.emplace_back(tDist(tGen), 1 + (tDist(tGen) + 20) % 5);
+        }
+        if (multimodular_determinant(tRandom) == Fraction<int64_t>(0, 1))
+            continue;
+
+        EXPECT_EQ(dixon_solve(tRandom, std::span<const Fraction<int64_t>>{tRandomRhs}),
+                  multimodular_solve(tRandom, std::span<const Fraction<int64_t>>{tRandomRhs}));
+    }
+
+    // The spurious candidate after two digits has a common denominator whose check overflows __int128;
+    // it is rejected and the solution is found after four digits.
+    const FractionMatrix<int64_t> tSpurious{
+        {Fraction<int64_t>{-441}, Fraction<int64_t>{-386}, Fraction<int64_t>{395}, Fraction<int64_t>{391}},
+        {Fraction<int64_t>{-254}, Fraction<int64_t>{-105}, Fraction<int64_t>{-512}, Fraction<int64_t>{223}},
+        {Fraction<int64_t>{123}, Fraction<int64_t>{-475}, Fraction<int64_t>{-279}, Fraction<int64_t>{-43}},
+        {Fraction<int64_t>{85}, Fraction<int64_t>{-49}, Fraction<int64_t>{-112}, Fraction<int64_t>{105}},
+    };
+    const std::vector<Fraction<int64_t>> tSpuriousRhs{Fraction<int64_t>{-248}, Fraction<int64_t>{415}, Fraction<int64_t>{-270},
+                                                      Fraction<int64_t>{-505}};
+    const auto tLifted = dixon_solve(tSpurious, std::span<const Fraction<int64_t>>{tSpuriousRhs});
+    ASSERT_EQ(tLifted.size(), 4u);
+    EXPECT_EQ(tLifted[0], Fraction<int64_t>(-7627916318, 2543611575));
+    EXPECT_EQ(tLifted[1], Fraction<int64_t>(1143938566, 2543611575));
+    EXPECT_EQ(tLifted[2], Fraction<int64_t>(-571788909, 847870525));
+    EXPECT_EQ(tLifted[3], Fraction<int64_t>(-7354467067, 2543611575));
+
+    const FractionMatrix<int64_t> tSingular{
+        {Fraction<int64_t>{1}, Fraction<int64_t>{2}},
+        {Fraction<int64_t>{2}, Fraction<int64_t>{4}},
+    };
+    const std::vector<Fraction<int64_t>> tRhs2{Fraction<int64_t>{1}, Fraction<int64_t>{1}};
+    EXPECT_THROW(auto tTemp = dixon_solve(tSingular, std::span<const Fraction<int64_t>>{tRhs2}), std::invalid_argument);
+}
@@ -0,0 +1,83 @@
+#include "FractionModular.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+struct FractionModularTest : public testing::Test
+{
+};
+
+TEST_F(FractionModularTest, Primitives)
+{
+    EXPECT_EQ(mod_inverse(3, 7), 5u);
+    EXPECT_EQ(mod_inverse(4, 8), 0u);
+    EXPECT_EQ(mod_pow(2, 10, 1000), 24u);
+    EXPECT_TRUE(is_prime_u64(2305843009213693951ull));
+    EXPECT_FALSE(is_prime_u64(2305843009213693953ull));
+
+    const auto tPrimes = word_primes(3);
+    ASSERT_EQ(tPrimes.size(), 3u);
+    EXPECT_GT(tPrimes[0], tPrimes[1]);
+    EXPECT_LT(tPrimes[0], 1ull << 62);
+
+    ChineseRemainder<int64_t> tCRT;
+    tCRT.add(2, 3);
+    tCRT.add(3, 5);
+    tCRT.add(2, 7);
+    EXPECT_EQ(tCRT.getValue(), 23);
+    EXPECT_EQ(tCRT.getModulus(), 105);
+}
+
+TEST_F(FractionModularTest, RationalReconstruct)
+{
+    constexpr int64_t kPrime = 1'000'000'007;
+    constexpr int64_t kBound = 22'000;
+
+    // 2/7 modulo kPrime
+    const auto tResidue = static_cast<int64_t>(mod_mul(2, mod_inverse(7, kPrime), kPrime));
+    const auto tFraction = rational_reconstruct<int64_t>(tResidue, kPrime, kBound, kBound);
+    ASSERT_TRUE(tFraction.has_value());
+    EXPECT_EQ(*tFraction, Fraction<int64_t>(2, 7));
+
+    const auto tNegative = static_cast<int64_t>(mod_mul(kPrime - 5, mod_inverse(12, kPrime), kPrime));
+    EXPECT_EQ(rational_reconstruct<int64_t>(tNegative, kPrime, kBound, kBound), Fraction<int64_t>(-5, 12));
+
+    EXPECT_EQ(rational_reconstruct<int64_t>(100, 1009, 5, 5), std::nullopt);
+    EXPECT_EQ(rational_reconstruct<int64_t>(0, 1009, 20, 20), Fraction<int64_t>(0, 1));
+}
+
+TEST_F(FractionModularTest, RationalReconstructBatch)
+{
+    constexpr int64_t kPrime = 1'000'000'007;
+    const auto tImage = [](int64_t n, int64_t d)
+    {
+        const auto tNum = static_cast<uint64_t>(n < 0 ? n + kPrime : n);
+        return static_cast<int64_t>(mod_mul(tNum, mod_inverse(static_cast<uint64_t>(d), kPrime), kPrime));
+    };
+
+    const std::vector<int64_t> tResidues{tImage(1, 6), tImage(-5, 6), tImage(7, 3), tImage(3, 10)};
+    const auto tResult = rational_reconstruct<int64_t>(std::span<const int64_t>{tResidues}, kPrime, 20'000, 20'000);
+    ASSERT_TRUE(tResult.has_value());
+    ASSERT_EQ(tResult->size(), 4u);
+    EXPECT_EQ((*tResult)[0], Fraction<int64_t>(1, 6));
+    EXPECT_EQ((*tResult)[1], Fraction<int64_t>(-5, 6));
+    EXPECT_EQ((*tResult)[2], Fraction<int64_t>(7, 3));
+    EXPECT_EQ((*tResult)[3], Fraction<int64_t>(3, 10));
+
+    // Numerators close to the bound: scaled by the common denominator they leave the bound.
+    constexpr int64_t kSmallPrime = 10'007;
+    const auto tSmallImage = [](int64_t n, int64_t d)
+    {
+        const auto tNum = static_cast<uint64_t>(n < 0 ? n + kSmallPrime : n);
+        return static_cast<int64_t>(mod_mul(tNum, mod_inverse(static_cast<uint64_t>(d), kSmallPrime), kSmallPrime));
+    };
+    const std::vector<int64_t> tNearBound{tSmallImage(1, 3), tSmallImage(50, 7), tSmallImage(69, 5), tSmallImage(-67, 2), tSmallImage(2, 21)};
+    const auto tNearResult = rational_reconstruct<int64_t>(std::span<const int64_t>{tNearBound}, kSmallPrime, 70, 70);
+    ASSERT_TRUE(tNearResult.has_value());
+    ASSERT_EQ(tNearResult->size(), 5u);
+    EXPECT_EQ((*tNearResult)[0], Fraction<int64_t>(1, 3));
+    EXPECT_EQ((*tNearResult)[1], Fraction<int64_t>(50, 7));
+    EXPECT_EQ((*tNearResult)[2], Fraction<int64_t>(69, 5));
+    EXPECT_EQ((*tNearResult)[3], Fraction<int64_t>(-67, 2));
+    EXPECT_EQ((*tNearResult)[4], Fraction<int64_t>(2, 21));
+}
@@ -0,0 +1,89 @@
+#include "FractionPipeline.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+struct FractionPipelineTest : public testing::Test
+{
+};
+
+FractionGenerator<Fraction<int64_t>> unit_fractions(int64_t xCount)
+{
+    for (int64_t i = 1; i <= xCount; ++i)
+        co_yield Fraction<int64_t>{1, i};
+}
+
+FractionGenerator<int> failing()
+{
+    co_yield 1;
+    throw std::runtime_error("source failed");
+}
+
+TEST_F(FractionPipelineTest, Generator)
+{
+    std::vector<int64_t> tDenominators;
+    for (const auto &tValue : unit_fractions(4))
+        tDenominators.push_back(tValue.getDenominator());
+    EXPECT_EQ(tDenominators, (std::vector<int64_t>{1, 2, 3, 4}));
+
+    std::vector<Fraction<int>> tValues{Fraction<int>(1, 2), Fraction<int>(1, 3), Fraction<int>(1, 4)};
+    std::vector<std::size_t> tSizes;
+    for (const auto &tBatch : batched<int>(tValues, 2))
+        tSizes.push_back(tBatch.size());
+    EXPECT_EQ(tSizes, (std::vector<std::size_t>{2, 1}));
+    EXPECT_THROW((void)batched<int>(tValues, 0), std::invalid_argument);
+
+    auto tFailing = failing();
+    auto tIt = tFailing.begin();
+    EXPECT_EQ(*tIt, 1);
+    EXPECT_THROW(++tIt, std::runtime_error);
+}
+
+TEST_F(FractionPipelineTest, StagesAndBackPressure)
+{
+    std::vector<Fraction<int64_t>> tValues;
+    for (int64_t i = 0; i < 1000; ++i)
+        tValues.emplace_back(2 * i, 4);
+
+    std::atomic<int> tInFlight{0};
+    std::atomic<int> tMaxInFlight{0};
+    FractionPipeline<int64_t> tPipeline{1};
+    tPipeline
+        .then(
+            [&](FractionBatch<int64_t> &xBatch)
+            {
+                const int tCount = ++tInFlight;
+                tMaxInFlight = std::max(tMaxInFlight.load(), tCount);
+                for (auto &tValue : xBatch)
+                    tValue.simplify();
+            })
+        .then(
+            [](FractionBatch<int64_t> &xBatch)
+            {
+                for (auto &tValue : xBatch)
+                    tValue *= Fraction<int64_t>{2, 1};
+            });
+    EXPECT_EQ(tPipeline.stages(), 2u);
+
+    std::vector<int64_t> tNumerators;
+    tPipeline.run(batched<int64_t>(tValues, 64),
+                  [&](FractionBatch<int64_t> &&xBatch)
+                  {
+                      --tInFlight;
+                      for (const auto &tValue : xBatch)
+                          tNumerators.push_back(tValue.getNumerator() / tValue.getDenominator());
+                  });
+
+    ASSERT_EQ(tNumerators.size(), tValues.size());
+    for (std::size_t i = 0; i < tNumerators.size(); ++i)
+        EXPECT_EQ(tNumerators[i], static_cast<int64_t>(i));
+    // Two channels of capacity 1 plus one batch in each stage and in the sink.
+    EXPECT_LE(tMaxInFlight.load(), 5);
+
+    FractionPipeline<int64_t> tFailing{2};
+    tFailing.then([](FractionBatch<int64_t> &) { throw std::domain_error("stage failed"); });
+    EXPECT_THROW(tFailing.run(batched<int64_t>(tValues, 8), [](FractionBatch<int64_t> &&) {}), std::domain_error);
+}
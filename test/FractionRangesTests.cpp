@@ -0,0 +1,74 @@
+#include "FractionRanges.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+struct FractionRangesTest : public testing::Test
+{
+};
+
+TEST_F(FractionRangesTest, BoundedConversion)
+{
+    EXPECT_EQ(to_Fraction_bounded(std::numbers::pi, 1000), Fraction<int>(355, 113));
+    EXPECT_EQ(to_Fraction_bounded(std::numbers::pi, 100), Fraction<int>(311, 99));
+    EXPECT_EQ(to_Fraction_bounded(std::numbers::pi, 1000000), Fraction<int>(3126535, 995207));
+    EXPECT_EQ(to_Fraction_bounded(std::numbers::e, std::numeric_limits<int32_t>::max()), Fraction<int32_t>(1032595833, 379870778));
+    EXPECT_EQ(to_Fraction_bounded(0.1, std::numeric_limits<int64_t>::max()), Fraction<int64_t>(3602879701896397, int64_t(1) << 55));
+    EXPECT_EQ(to_Fraction_bounded(-0.75, int64_t{10}), Fraction<int64_t>(-3, 4));
+    EXPECT_EQ(to_Fraction_bounded(0.3333, 2), Fraction<int>(1, 2));
+    EXPECT_EQ(to_Fraction_bounded(5.0, 1), Fraction<int>(5, 1));
+    EXPECT_THROW((void)to_Fraction_bounded(1.0, 0), std::invalid_argument);
+    EXPECT_THROW((void)to_Fraction_bounded(1e20, 7), std::overflow_error);
+}
+
+TEST_F(FractionRangesTest, TransformViews)
+{
+    const std::vector<Fraction<int>> tValues{Fraction<int>(2, 4), Fraction<int>(9, 3), Fraction<int>(-5, 10)};
+
+    auto tSimplified = tValues | fraction_views::simplified;
+    static_assert(std::ranges::random_access_range<decltype(tSimplified)>);
+    EXPECT_EQ(tSimplified[0], Fraction<int>(1, 2));
+    EXPECT_EQ(tSimplified[1], Fraction<int>(3, 1));
+
+    std::vector<double> tDoubles;
+    std::ranges::copy(tValues | fraction_views::to_double, std::back_inserter(tDoubles));
+    EXPECT_EQ(tDoubles, (std::vector<double>{0.5, 3.0, -0.5}));
+
+    const std::vector<double> tInputs{0.1, 0.125, -2.5};
+    std::vector<Fraction<int>> tFractions;
+    std::ranges::copy(tInputs | fraction_views::from_double(16), std::back_inserter(tFractions));
+    EXPECT_EQ(tFractions, (std::vector<Fraction<int>>{Fraction<int>(1, 10), Fraction<int>(1, 8), Fraction<int>(-5, 2)}));
+}
+
+TEST_F(FractionRangesTest, PartialSums)
+{
+    const std::vector<Fraction<int64_t>> tValues{Fraction<int64_t>(1, 2), Fraction<int64_t>(1, 3), Fraction<int64_t>(1, 6), Fraction<int64_t>(-1, 1)};
+
+    std::vector<Fraction<int64_t>> tSums;
+    for (const auto &tSum : tValues | fraction_views::partial_sums)
+        tSums.push_back(tSum);
+    EXPECT_EQ(tSums, (std::vector<Fraction<int64_t>>{Fraction<int64_t>(1, 2), Fraction<int64_t>(5, 6), Fraction<int64_t>(1, 1), Fraction<int64_t>(0, 1)}));
+
+    auto tView = fraction_views::partial_sums(tValues | std::views::take(2));
+    static_assert(std::ranges::forward_range<decltype(tView)>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(tView)>, Fraction<int64_t>>);
+    EXPECT_EQ(tView.size(), 2u);
+    EXPECT_EQ(*std::ranges::next(tView.begin()), Fraction<int64_t>(5, 6));
+
+    // A sum must stay valid after the iterator that produced it advances.
+    auto tIterator = tView.begin();
+    const auto &tFirst = *tIterator;
+    ++tIterator;
+    EXPECT_EQ(tFirst, Fraction<int64_t>(1, 2));
+    EXPECT_EQ(*tIterator, Fraction<int64_t>(5, 6));
+
+    const std::vector<Fraction<int64_t>> tEmpty;
+    EXPECT_TRUE(std::ranges::empty(tEmpty | fraction_views::partial_sums));
+}
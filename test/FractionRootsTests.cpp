@@ -0,0 +1,107 @@
+#include "FractionRoots.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+struct FractionRootsTest : public testing::Test
+{
+    /**
+     * @brief Checks that the intervals are sorted, disjoint and that interval i contains xRoots[i].
+     */
+    template <typename Type>
+    static void expectIsolates(const std::vector<RootInterval<Type>> &xIntervals, const std::vector<double> &xRoots)
+    {
+        ASSERT_EQ(xIntervals.size(), xRoots.size());
+        for (std::size_t i = 0; i < xRoots.size(); ++i)
+        {
+            const double tLower = xIntervals[i].lower.to_double();
+            const double tUpper = xIntervals[i].upper.to_double();
+            if (xIntervals[i].isExact())
+            {
+                EXPECT_DOUBLE_EQ(tLower, xRoots[i]) << i;
+            }
+            else
+            {
+                EXPECT_LT(tLower, xRoots[i]) << i;
+                EXPECT_GT(tUpper, xRoots[i]) << i;
+            }
+            if (i > 0)
+            {
+                EXPECT_LE(xIntervals[i - 1].upper.to_double(), tLower) << i;
+            }
+        }
+    }
+};
+
+TEST_F(FractionRootsTest, RationalAndIrrationalRoots)
+{
+    // (x - 1)(x + 2)(2x - 3) = 2x^3 - x^2 - 7x + 6
+    const std::vector<int> tRational{6, -7, -1, 2};
+    const auto tExact = isolate_real_roots<int>(tRational);
+    expectIsolates(tExact, {-2.0, 1.0, 1.5});
+    EXPECT_TRUE(tExact[1].isExact());
+
+    const std::vector<int> tSqrt2{-2, 0, 1};
+    expectIsolates(isolate_real_roots<int>(tSqrt2), {-std::sqrt(2.0), std::sqrt(2.0)});
+
+    // x^3 (x^2 + 1) has the single real root 0.
+    const std::vector<int> tZero{0, 0, 0, 1, 0, 1};
+    const auto tZeroRoots = isolate_real_roots<int>(tZero);
+    ASSERT_EQ(tZeroRoots.size(), 1u);
+    EXPECT_TRUE(tZeroRoots[0].isExact());
+    EXPECT_EQ(tZeroRoots[0].lower.getNumerator(), 0);
+
+    const std::vector<int> tNone{1, 0, 1};
+    EXPECT_TRUE(isolate_real_roots<int>(tNone).empty());
+    EXPECT_THROW((void)isolate_real_roots<int>(std::vector<int>{0, 0}), std::invalid_argument);
+}
+
+TEST_F(FractionRootsTest, RepeatedAndCloseRoots)
+{
+    // (x - 1)^2 (x^2 - 2) = x^4 - 2x^3 - x^2 + 4x - 2
+    const std::vector<int64_t> tRepeated{-2, 4, -1, -2, 1};
+    expectIsolates(isolate_real_roots<int64_t>(tRepeated), {-std::sqrt(2.0), 1.0, std::sqrt(2.0)});
+
+    // (1000x - 1001)(1000x - 1002): roots 1/1000 apart.
+    const std::vector<int64_t> tClose{1003002, -2003000, 1000000};
+    expectIsolates(isolate_real_roots<int64_t>(tClose), {1.001, 1.002});
+
+    // Large root, reached through lower bound shifts.
+    const std::vector<int64_t> tLarge{-1000000007, 0, 1};
+    expectIsolates(isolate_real_roots<int64_t>(tLarge), {-std::sqrt(1000000007.0), std::sqrt(1000000007.0)});
+
+    // (288x - 276)^2 (-202x + 98)(281x - 159): the square-free reduction needs GCDs of more than 64 bits.
+    const std::vector<int64_t> tWide{-1186974432, 7021519488, -15100207776, 13971902976, -4708067328};
+    expectIsolates(isolate_real_roots<int64_t>(tWide), {49.0 / 101.0, 159.0 / 281.0, 23.0 / 24.0});
+}
+
+TEST_F(FractionRootsTest, Parallel)
+{
+    // Wilkinson-like (x - 1)(x - 2)...(x - 12) with a small perturbation to get irrational roots.
+    std::vector<int64_t> tPoly{1};
+    for (int64_t r = 1; r <= 12; ++r)
+    {
+        std::vector<int64_t> tNext(tPoly.size() + 1, 0);
+        for (std::size_t i = 0; i < tPoly.size(); ++i)
+        {
+            tNext[i + 1] += tPoly[i];
+            tNext[i] -= r * tPoly[i];
+        }
+        tPoly = std::move(tNext);
+    }
+    tPoly[0] += 1;
+
+    const auto tSequential = isolate_real_roots<int64_t>(tPoly, RootIsolationOptions{1, 0});
+    const auto tParallel = isolate_real_roots<int64_t>(tPoly, RootIsolationOptions{4, 0});
+    ASSERT_EQ(tSequential.size(), tParallel.size());
+    ASSERT_EQ(tSequential.size(), 12u);
+    for (std::size_t i = 0; i < tSequential.size(); ++i)
+    {
+        EXPECT_EQ(tSequential[i].lower.to_double(), tParallel[i].lower.to_double()) << i;
+        EXPECT_EQ(tSequential[i].upper.to_double(), tParallel[i].upper.to_double()) << i;
+        EXPECT_LT(tSequential[i].lower.to_double(), static_cast<double>(i + 1) + 0.5) << i;
+        EXPECT_GT(tSequential[i].upper.to_double(), static_cast<double>(i + 1) - 0.5) << i;
+    }
+}
@@ -0,0 +1,52 @@
+#include "FractionSeries.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+struct FractionSeriesTest : public testing::Test
+{
+};
+
+TEST_F(FractionSeriesTest, HarmonicNumbers)
+{
+    EXPECT_EQ(harmonic_number<int64_t>(0), Fraction<int64_t>(0, 1));
+    EXPECT_EQ(harmonic_number<int64_t>(1), Fraction<int64_t>(1, 1));
+    EXPECT_EQ(harmonic_number<int64_t>(10), Fraction<int64_t>(7381, 2520));
+    EXPECT_EQ(harmonic_number<int64_t>(15), Fraction<int64_t>(1195757, 360360));
+
+    const FractionParallelOptions tParallel{4, 1};
+    EXPECT_EQ(harmonic_number<int64_t>(15, tParallel), Fraction<int64_t>(1195757, 360360));
+    EXPECT_EQ(harmonic_number<int64_t>(3, tParallel), Fraction<int64_t>(11, 6));
+
+    // 20! is the largest factorial in std::int64_t.
+    EXPECT_EQ(harmonic_number<int64_t>(20), Fraction<int64_t>(55835135, 15519504));
+    EXPECT_THROW(auto tTemp = harmonic_number<int64_t>(21), std::overflow_error);
+    EXPECT_THROW(auto tTemp = harmonic_number<int64_t>(21, tParallel), std::overflow_error);
+}
+
+TEST_F(FractionSeriesTest, Constants)
+{
+    const auto tE = e_partial_sum<int64_t>(10);
+    EXPECT_EQ(tE, Fraction<int64_t>(98641, 36288));
+    EXPECT_EQ(e_partial_sum<int64_t>(10, FractionParallelOptions{3, 1}), tE);
+    EXPECT_NEAR(e_partial_sum<int64_t>(18).to_double(), std::numbers::e, 1e-15);
+
+    EXPECT_EQ(arctan_inverse_partial_sum<int64_t>(5, 2), Fraction<int64_t>(74, 375));
+    EXPECT_NEAR(pi_partial_sum<int64_t>(3).to_double(), std::numbers::pi, 1e-4);
+    EXPECT_THROW(auto tTemp = pi_partial_sum<int64_t>(4), std::overflow_error);
+}
+
+TEST_F(FractionSeriesTest, BernoulliNumbers)
+{
+    EXPECT_EQ(bernoulli_number<int64_t>(0), Fraction<int64_t>(1, 1));
+    EXPECT_EQ(bernoulli_number<int64_t>(1), Fraction<int64_t>(-1, 2));
+    EXPECT_EQ(bernoulli_number<int64_t>(2), Fraction<int64_t>(1, 6));
+    EXPECT_EQ(bernoulli_number<int64_t>(3), Fraction<int64_t>(0, 1));
+    EXPECT_EQ(bernoulli_number<int64_t>(4), Fraction<int64_t>(-1, 30));
+    EXPECT_EQ(bernoulli_number<int64_t>(10), Fraction<int64_t>(5, 66));
+    EXPECT_EQ(bernoulli_number<int64_t>(12, FractionParallelOptions{4, 1}), Fraction<int64_t>(-691, 2730));
+    EXPECT_THROW(auto tTemp = bernoulli_number<int64_t>(13), std::overflow_error);
+    EXPECT_THROW(auto tTemp = bernoulli_number<int64_t>(20), std::overflow_error);
+}
@@ -0,0 +1,71 @@
+#include "FractionStepper.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+struct FractionStepperTest : public testing::Test
+{
+};
+
+TEST_F(FractionStepperTest, Stepping)
+{
+    const Fraction<int64_t> tStart{-1, 3};
+    const Fraction<int64_t> tStep{3, 4};
+    FractionStepper<int64_t> tStepper{tStart, tStep};
+    EXPECT_EQ(tStepper.denominator(), 12);
+    EXPECT_EQ(tStepper.whole(), -1);
+    EXPECT_EQ(tStepper.remainder(), 8);
+
+    for (int64_t k = 0; k < 50; ++k, ++tStepper)
+    {
+        const auto tExpected = Fraction<int64_t>{-4 + 9 * k, 12}.simplify();
+        EXPECT_EQ(tStepper.value(), tExpected) << k;
+    }
+
+    FractionStepper<int64_t> tBackwards{Fraction<int64_t>{1, 2}, Fraction<int64_t>{5, -3}};
+    for (int k = 0; k < 5; ++k)
+        ++tBackwards;
+    EXPECT_EQ(tBackwards.value(), Fraction<int64_t>(-47, 6));
+
+    FractionStepper<int64_t> tJump{tStart, tStep};
+    tJump.advance(1000);
+    EXPECT_EQ(tJump.value(), Fraction<int64_t>(8996, 12).simplify());
+}
+
+TEST_F(FractionStepperTest, Resampling)
+{
+    // Source sample position of every output sample when converting 44.1 kHz to 48 kHz.
+    FractionStepper<int32_t> tStepper{Fraction<int32_t>{0, 1}, Fraction<int32_t>{44100, 48000}};
+    for (int i = 0; i < 480; ++i)
+        ++tStepper;
+    EXPECT_EQ(tStepper.whole(), 441);
+    EXPECT_EQ(tStepper.remainder(), 0);
+
+    std::vector<int32_t> tWholes(1001);
+    std::vector<int32_t> tRemainders(tWholes.size());
+    step_range(tStepper, std::span{tWholes}, std::span{tRemainders});
+
+    auto tSequential = tStepper;
+    for (std::size_t i = 0; i < tWholes.size(); ++i, ++tSequential)
+    {
+        EXPECT_EQ(tWholes[i], tSequential.whole()) << i;
+        EXPECT_EQ(tRemainders[i], tSequential.remainder()) << i;
+    }
+    EXPECT_THROW(step_range(tStepper, std::span{tWholes}, std::span{tRemainders}.first(3)), std::invalid_argument);
+
+    // Ranges shorter than or not a multiple of the lane count.
+    for (const std::size_t tSize : {0, 5, 8, 17})
+    {
+        std::vector<int64_t> tShortWholes(tSize);
+        std::vector<int64_t> tShortRemainders(tSize);
+        const FractionStepper<int64_t> tLarge{Fraction<int64_t>{-7, 3}, Fraction<int64_t>{5, 9}};
+        step_range(tLarge, std::span{tShortWholes}, std::span{tShortRemainders});
+        auto tExpected = tLarge;
+        for (std::size_t i = 0; i < tSize; ++i, ++tExpected)
+        {
+            EXPECT_EQ(tShortWholes[i], tExpected.whole()) << tSize << " " << i;
+            EXPECT_EQ(tShortRemainders[i], tExpected.remainder()) << tSize << " " << i;
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include "Fraction.h"
 
 #include <gtest/gtest.h>
+#include <limits>
 #include <random>
 #include <numbers>
 
@@ -428,3 +429,36 @@ TEST_F(FractionTest, Atan2)
     actual = atan2(y,x);
     EXPECT_EQ(expected, actual);
 }
+
+TEST_F(FractionTest, Rounding)
+{
+    const Fraction<int> tNegative{-7, 2};
+    EXPECT_EQ(floor(tNegative), -4);
+    EXPECT_EQ(ceil(tNegative), -3);
+    EXPECT_EQ(trunc(tNegative), -3);
+    EXPECT_EQ(round(tNegative), -4);
+    EXPECT_EQ(round(tNegative, RoundingMode::HalfDown), -3);
+    EXPECT_EQ(round(tNegative, RoundingMode::HalfEven), -4);
+    EXPECT_EQ(round(Fraction<int>{5, -2}, RoundingMode::HalfEven), -2);
+    EXPECT_EQ(round(Fraction<int>{8, 3}), 3);
+    EXPECT_EQ(floor(Fraction<int>{6, 3}), 2);
+    EXPECT_EQ(ceil(Fraction<unsigned>{7u, 2u}), 4u);
+
+    // Exact also where double conversion loses the integer part.
+    constexpr int64_t kBig = std::numeric_limits<int64_t>::max();
+    EXPECT_EQ(floor(Fraction<int64_t>{kBig, 1}), kBig);
+    EXPECT_EQ(ceil(Fraction<int64_t>{kBig - 1, 2}), kBig / 2);
+    EXPECT_EQ(floor(Fraction<int64_t>{std::numeric_limits<int64_t>::min(), 3}), std::numeric_limits<int64_t>::min() / 3 - 1);
+
+    const auto tParts = mixed_parts(tNegative);
+    EXPECT_EQ(tParts.whole, -3);
+    EXPECT_EQ(tParts.fraction, Fraction<int>(-1, 2));
+
+    const auto tDivMod = divmod(Fraction<int>{7, 2}, Fraction<int>{-2, 3});
+    EXPECT_EQ(tDivMod.quotient, -6);
+    EXPECT_EQ(tDivMod.remainder, Fraction<int>(-1, 2));
+    const auto tPositive = divmod(Fraction<int>{7, 2}, Fraction<int>{2, 3});
+    EXPECT_EQ(tPositive.quotient, 5);
+    EXPECT_EQ(tPositive.remainder, Fraction<int>(1, 6));
+    EXPECT_THROW((void)divmod(Fraction<int>{7, 2}, Fraction<int>{0, 3}), std::invalid_argument);
+}